@@ -0,0 +1,148 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Kept in their own translation unit so the replacement operators are
+// never inlined into their callers
+static std::atomic<uint64_t> allocationCount(0);
+static std::atomic<uint64_t> allocatedBytes(0);
+
+/* Get Allocation Count
+- Returns: The number of calls to any form of operator new so far,
+  including aligned and nothrow ones. */
+uint64_t getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+/* Get Allocated Bytes
+- Returns: The total size requested from operator new so far. Memory that
+  was freed again is still counted. */
+uint64_t getAllocatedBytes() {
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+/* Counted Allocate
+- Counts an allocation and takes the memory from malloc, or from
+  aligned_alloc for over-aligned types.
+- Parameters:
+    - size: The number of bytes requested.
+    - alignment: The alignment requested, 0 for the default.
+- Returns: The memory, or nullptr if it could not be allocated. */
+static void* countedAllocate(std::size_t size, std::size_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size ? size : 1);
+    }
+    // aligned_alloc needs a size that is a multiple of the alignment
+    const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded ? rounded : alignment);
+}
+
+void* operator new(std::size_t size) {
+    if (void* memory = countedAllocate(size, 0)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* memory =
+            countedAllocate(size, static_cast<std::size_t>(alignment))) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, 0);
+}
+
+void* operator new(
+    std::size_t size,
+    std::align_val_t alignment,
+    const std::nothrow_t&
+) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](
+    std::size_t size,
+    std::align_val_t alignment,
+    const std::nothrow_t&
+) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+// Every allocation above comes from malloc or aligned_alloc, so free
+// releases all of them
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+void operator delete(
+    void* memory,
+    std::align_val_t,
+    const std::nothrow_t&
+) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](
+    void* memory,
+    std::align_val_t,
+    const std::nothrow_t&
+) noexcept {
+    std::free(memory);
+}
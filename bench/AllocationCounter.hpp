@@ -0,0 +1,12 @@
+#ifndef OMELETTE_BENCH_ALLOCATIONCOUNTER_HPP
+#define OMELETTE_BENCH_ALLOCATIONCOUNTER_HPP
+
+#include <cstdint>
+
+// Totals kept by the replacement global operator new of the benchmark
+// runner, over every thread since the program started. Take the
+// difference of two readings to measure a section.
+uint64_t getAllocationCount();
+uint64_t getAllocatedBytes();
+
+#endif // OMELETTE_BENCH_ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,632 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ecs/Components/ColliderComponent.hpp>
+#include <ecs/Components/MeshComponent.hpp>
+#include <ecs/Components/RigidBodyComponent.hpp>
+#include <ecs/ECS.hpp>
+#include <ecs/Scheduler.hpp>
+#include <ecs/Systems/BroadphaseSystem.hpp>
+#include <ecs/Systems/ContactSolverSystem.hpp>
+#include <ecs/Systems/IntegrationSystem.hpp>
+#include <ecs/Systems/IslandSystem.hpp>
+#include <ecs/Systems/MeshTransformSystem.hpp>
+#include <ecs/Systems/NarrowphaseSystem.hpp>
+#include <ecs/World.hpp>
+#include <functional>
+#include <glm/gtc/matrix_transform.hpp>
+#include <memory>
+#include <physics/ConvexHull.hpp>
+#include <string>
+#include <utility>
+#include <utils/MeshCache.hpp>
+#include <utils/Profiler.hpp>
+#include <utils/Shapes.hpp>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+// Headless benchmark runner. Each run builds one scene, times it and prints
+// one JSON object per measurement to stdout, so results can be collected
+// and compared between builds. Run it through `meson benchmark` or by hand:
+//
+//     omelette-bench <scenario> [--bodies=N] [--steps=N] [--warmup=N]
+//                               [--threads=N] [--level=N] [--trace=FILE]
+//
+// Peak RSS is the high-water mark of the whole process, so run one
+// scenario per process when comparing it. --trace writes the profiling
+// zones of the timed steps as a Chrome trace; it needs a build with
+// -Dprofiling=true.
+
+using omelette::ecs::components::ColliderComponent;
+using omelette::ecs::components::MeshComponent;
+using omelette::ecs::components::RigidBodyComponent;
+using omelette::utils::Vec3;
+
+// Run options, from the command line
+struct Options {
+    std::string scenario;
+    unsigned int bodies = 1000; // Bodies or entities in the scene
+    unsigned int steps = 300; // Timed steps or iterations
+    unsigned int warmup = 30; // Untimed steps run first
+    unsigned int threads = 0; // Scheduler threads; 0 for every core
+    unsigned int level = 5; // Highest subdivision level for shapes
+    std::string trace; // Chrome trace output file, if any
+};
+
+// Collision shape of the bodies dropped by the falling scenarios
+enum class BodyShape { Cube, Sphere, Hull };
+
+// Time, allocations and memory of one measured section
+struct Measurement {
+    double seconds = 0.0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+// Function declarations
+bool parseOptions(int argc, char** argv, Options& options);
+void printUsage();
+Measurement measure(const std::function<void()>& function);
+long peakResidentKilobytes();
+void report(
+    const std::string& benchmark,
+    const std::vector<std::pair<std::string, double>>& fields,
+    const Measurement& measurement
+);
+int runFallingBodies(const Options& options, BodyShape bodyShape);
+int runIntegrate(const Options& options);
+int runChurn(const Options& options, bool bulk);
+int runShapes(const Options& options);
+int runQuery(const Options& options);
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    if (!options.trace.empty()) {
+#ifdef OMELETTE_PROFILE
+        omelette::utils::Profiler::get().setAllocationCounter(
+            getAllocationCount
+        );
+#else
+        std::fprintf(stderr, "Built without profiling; --trace is empty\n");
+#endif
+    }
+
+    if (options.scenario == "falling-cubes") {
+        return runFallingBodies(options, BodyShape::Cube);
+    }
+    if (options.scenario == "falling-spheres") {
+        return runFallingBodies(options, BodyShape::Sphere);
+    }
+    if (options.scenario == "falling-hulls") {
+        return runFallingBodies(options, BodyShape::Hull);
+    }
+    if (options.scenario == "integrate") {
+        return runIntegrate(options);
+    }
+    if (options.scenario == "churn") {
+        return runChurn(options, false);
+    }
+    if (options.scenario == "churn-bulk") {
+        return runChurn(options, true);
+    }
+    if (options.scenario == "shapes") {
+        return runShapes(options);
+    }
+    if (options.scenario == "query") {
+        return runQuery(options);
+    }
+
+    std::fprintf(stderr, "Unknown scenario: %s\n", options.scenario.c_str());
+    printUsage();
+    return 2;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    if (argc < 2) {
+        return false;
+    }
+    options.scenario = argv[1];
+
+    for (int i = 2; i < argc; i++) {
+        const char* argument = argv[i];
+        const char* equals = std::strchr(argument, '=');
+        if (std::strncmp(argument, "--", 2) != 0 || !equals) {
+            return false;
+        }
+
+        const std::string name(argument + 2, equals);
+        if (name == "trace") {
+            options.trace = equals + 1;
+            continue;
+        }
+
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(equals + 1, &end, 10);
+        if (end == equals + 1 || *end != '\0') {
+            return false;
+        }
+
+        if (name == "bodies") {
+            options.bodies = static_cast<unsigned int>(value);
+        } else if (name == "steps") {
+            options.steps = static_cast<unsigned int>(value);
+        } else if (name == "warmup") {
+            options.warmup = static_cast<unsigned int>(value);
+        } else if (name == "threads") {
+            options.threads = static_cast<unsigned int>(value);
+        } else if (name == "level") {
+            options.level = static_cast<unsigned int>(value);
+        } else {
+            return false;
+        }
+    }
+    return options.steps > 0;
+}
+
+void printUsage() {
+    std::fprintf(
+        stderr,
+        "Usage: omelette-bench <scenario> [--bodies=N] [--steps=N] "
+        "[--warmup=N] [--threads=N] [--level=N] [--trace=FILE]\n"
+        "Scenarios: falling-cubes, falling-spheres, falling-hulls, "
+        "integrate, churn, churn-bulk, shapes, query\n"
+    );
+}
+
+Measurement measure(const std::function<void()>& function) {
+    const uint64_t allocationsBefore = getAllocationCount();
+    const uint64_t bytesBefore = getAllocatedBytes();
+    const auto start = std::chrono::steady_clock::now();
+
+    function();
+
+    const auto end = std::chrono::steady_clock::now();
+    Measurement measurement;
+    measurement.seconds = std::chrono::duration<double>(end - start).count();
+    measurement.allocations = getAllocationCount() - allocationsBefore;
+    measurement.bytes = getAllocatedBytes() - bytesBefore;
+    return measurement;
+}
+
+long peakResidentKilobytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+    #ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // Bytes on macOS
+    #else
+    return usage.ru_maxrss; // Kilobytes on Linux and the BSDs
+    #endif
+#else
+    return -1;
+#endif
+}
+
+void report(
+    const std::string& benchmark,
+    const std::vector<std::pair<std::string, double>>& fields,
+    const Measurement& measurement
+) {
+    std::printf("{\"benchmark\": \"%s\"", benchmark.c_str());
+    for (const auto& [name, value] : fields) {
+        std::printf(", \"%s\": %.9g", name.c_str(), value);
+    }
+    std::printf(
+        ", \"seconds\": %.9g, \"allocations\": %llu, \"allocated_bytes\": "
+        "%llu, \"peak_rss_kb\": %ld}\n",
+        measurement.seconds,
+        static_cast<unsigned long long>(measurement.allocations),
+        static_cast<unsigned long long>(measurement.bytes),
+        peakResidentKilobytes()
+    );
+    std::fflush(stdout);
+}
+
+// Pulls every awake dynamic body down at 9.81 m/s^2
+class GravitySystem: public omelette::ecs::System {
+  public:
+    omelette::ecs::ComponentAccess getAccess() const override {
+        return omelette::ecs::ComponentAccess().write<RigidBodyComponent>();
+    }
+
+    void update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) override {
+        ecs.view<RigidBodyComponent>().parallelEach(
+            threadPool,
+            [](RigidBodyComponent& body) {
+                if (body.mass > 0.0f && !body.sleeping) {
+                    body.acceleration += Vec3(0.0f, -9.81f, 0.0f);
+                }
+            },
+            256
+        );
+    }
+};
+
+// Add an entity with a mesh, a collider and a rigid body at a position;
+// zero mass makes it static
+omelette::ecs::Entity spawnBody(
+    omelette::ecs::ECS& ecs,
+    const omelette::utils::MeshHandle& mesh,
+    const omelette::physics::Shape& shape,
+    const Vec3& position,
+    float mass
+) {
+    auto entity = ecs.createEntity();
+    MeshComponent meshComponent(mesh);
+    meshComponent.setTransform(glm::translate(
+        glm::mat4(1.0f),
+        glm::vec3(position.x, position.y, position.z)
+    ));
+    ecs.addComponentToEntity(entity, std::move(meshComponent));
+    ecs.addComponentToEntity(entity, ColliderComponent(shape));
+    ecs.addComponentToEntity(
+        entity,
+        RigidBodyComponent(position, Vec3(), Vec3(), mass)
+    );
+    return entity;
+}
+
+/* Falling Bodies
+- Drops a grid of unit cubes, spheres or convex hulls onto a static ground
+  box and steps the full pipeline: gravity, broadphase, narrowphase,
+  islands, contact solving, integration and mesh transforms. Reports the
+  time per body per step. Cubes and spheres take the analytic contact
+  tests; hulls (unit cubes as convex hulls) take GJK and EPA. */
+int runFallingBodies(const Options& options, BodyShape bodyShape) {
+    omelette::ecs::World world(omelette::ecs::StepSettings(), options.threads);
+    omelette::ecs::ECS& ecs = world.getECS();
+    omelette::utils::MeshCache meshCache;
+
+    // Bodies stand in a square grid, in layers
+    const unsigned int side = std::max(
+        1u,
+        static_cast<unsigned int>(std::ceil(std::sqrt(options.bodies / 4.0)))
+    );
+    const float spacing = 1.5f;
+    const float groundSize = side * spacing + 4.0f;
+
+    spawnBody(
+        ecs,
+        meshCache.cube(groundSize, 1.0f, groundSize),
+        omelette::physics::Shape::box(
+            Vec3(groundSize / 2.0f, 0.5f, groundSize / 2.0f)
+        ),
+        Vec3(0.0f, -0.5f, 0.0f),
+        0.0f
+    );
+
+    const bool spheres = bodyShape == BodyShape::Sphere;
+    const auto mesh =
+        spheres ? meshCache.icosphere(0.5f, 1) : meshCache.cube();
+    auto makeShape = [&]() {
+        switch (bodyShape) {
+            case BodyShape::Sphere:
+                return omelette::physics::Shape::sphere(0.5f);
+            case BodyShape::Hull:
+                return omelette::physics::Shape::convexHull(
+                    std::make_shared<const omelette::physics::ConvexHull>(
+                        mesh->vertices,
+                        mesh->indices
+                    )
+                );
+            case BodyShape::Cube:
+            default:
+                return omelette::physics::Shape::box(Vec3(0.5f, 0.5f, 0.5f));
+        }
+    };
+    const auto shape = makeShape();
+    const float offset = (side - 1) * spacing / 2.0f;
+    for (unsigned int i = 0; i < options.bodies; i++) {
+        const unsigned int layer = i / (side * side);
+        const unsigned int row = (i / side) % side;
+        const unsigned int column = i % side;
+        spawnBody(
+            ecs,
+            mesh,
+            shape,
+            Vec3(
+                column * spacing - offset,
+                1.0f + layer * spacing,
+                row * spacing - offset
+            ),
+            1.0f
+        );
+    }
+
+    auto& scheduler = world.getScheduler();
+    scheduler.addSystem<GravitySystem>();
+    auto& broadphase =
+        scheduler.addSystem<omelette::ecs::systems::BroadphaseSystem>();
+    auto& narrowphase =
+        scheduler.addSystem<omelette::ecs::systems::NarrowphaseSystem>(
+            broadphase
+        );
+    scheduler.addSystem<omelette::ecs::systems::IslandSystem>(narrowphase);
+    scheduler.addSystem<omelette::ecs::systems::ContactSolverSystem>(
+        narrowphase
+    );
+    scheduler.addSystem<omelette::ecs::systems::IntegrationSystem>();
+    scheduler.addSystem<omelette::ecs::systems::MeshTransformSystem>();
+
+    for (unsigned int i = 0; i < options.warmup; i++) {
+        world.stepOnce();
+        OMELETTE_PROFILE_FRAME();
+    }
+
+    auto& profiler = omelette::utils::Profiler::get();
+    if (!options.trace.empty()) {
+        profiler.startCapture();
+    }
+    const Measurement measurement = measure([&] {
+        for (unsigned int i = 0; i < options.steps; i++) {
+            world.stepOnce();
+            OMELETTE_PROFILE_FRAME();
+        }
+    });
+    profiler.stopCapture();
+
+    if (!options.trace.empty() && !profiler.saveChromeTrace(options.trace)) {
+        std::fprintf(stderr, "Could not write %s\n", options.trace.c_str());
+        return 1;
+    }
+
+    const double steps = options.steps;
+    const double bodies = std::max(1u, options.bodies);
+    report(
+        options.scenario,
+        {{"bodies", options.bodies},
+         {"steps", steps},
+         {"ns_per_step", measurement.seconds * 1e9 / steps},
+         {"ns_per_body_step", measurement.seconds * 1e9 / (steps * bodies)},
+         {"allocations_per_step", measurement.allocations / steps}},
+        measurement
+    );
+    return 0;
+}
+
+/* Integrate
+- Steps only the IntegrationSystem over free-flying rigid bodies, the
+  per-step cost every simulation pays before any collision work. Reports
+  the time per body per step and the bodies integrated per millisecond. */
+int runIntegrate(const Options& options) {
+    omelette::ecs::ECS ecs;
+    ecs.createEntities(
+        options.bodies,
+        RigidBodyComponent(Vec3(), Vec3(1.0f, 2.0f, 3.0f), Vec3(), 1.0f)
+    );
+
+    omelette::ecs::Scheduler scheduler(options.threads);
+    scheduler.addSystem<omelette::ecs::systems::IntegrationSystem>();
+    const float deltaTime = 1.0f / 60.0f;
+
+    for (unsigned int i = 0; i < options.warmup; i++) {
+        scheduler.run(ecs, deltaTime);
+    }
+    const Measurement measurement = measure([&] {
+        for (unsigned int i = 0; i < options.steps; i++) {
+            scheduler.run(ecs, deltaTime);
+        }
+    });
+
+    const double steps = options.steps;
+    const double bodies = std::max(1u, options.bodies);
+    report(
+        options.scenario,
+        {{"bodies", options.bodies},
+         {"steps", steps},
+         {"ns_per_step", measurement.seconds * 1e9 / steps},
+         {"ns_per_body_step", measurement.seconds * 1e9 / (steps * bodies)},
+         {"bodies_per_ms", steps * bodies / (measurement.seconds * 1e3)},
+         {"allocations_per_step", measurement.allocations / steps}},
+        measurement
+    );
+    return 0;
+}
+
+/* Churn
+- Every iteration spawns a batch of bodies then destroys them all, the
+  pattern of short-lived projectiles and particles. With bulk, each batch
+  is spawned with one ECS::createEntities call and destroyed with one
+  destroyEntities call instead of entity by entity. Reports the time per
+  entity spawned and destroyed, and the component memory left reserved. */
+int runChurn(const Options& options, bool bulk) {
+    omelette::ecs::ECS ecs;
+    omelette::utils::MeshCache meshCache;
+    const auto mesh = meshCache.cube();
+    const auto shape = omelette::physics::Shape::box(Vec3(0.5f, 0.5f, 0.5f));
+
+    std::vector<omelette::ecs::Entity> entities;
+    entities.reserve(options.bodies);
+    auto churn = [&] {
+        if (bulk) {
+            entities = ecs.createEntities(
+                options.bodies,
+                MeshComponent(mesh),
+                ColliderComponent(shape),
+                RigidBodyComponent(Vec3(), Vec3(), Vec3(), 1.0f)
+            );
+            ecs.destroyEntities(entities);
+            return;
+        }
+        for (unsigned int i = 0; i < options.bodies; i++) {
+            entities.push_back(
+                spawnBody(ecs, mesh, shape, Vec3(float(i), 0.0f, 0.0f), 1.0f)
+            );
+        }
+        for (auto entity : entities) {
+            ecs.destroyEntity(entity);
+        }
+        entities.clear();
+    };
+
+    for (unsigned int i = 0; i < options.warmup; i++) {
+        churn();
+    }
+    const Measurement measurement = measure([&] {
+        for (unsigned int i = 0; i < options.steps; i++) {
+            churn();
+        }
+    });
+
+    size_t reservedBytes = 0;
+    for (const auto& [type, stats] : ecs.getComponentStats()) {
+        reservedBytes += stats.getReservedBytes();
+    }
+
+    const double entityCount =
+        double(options.steps) * std::max(1u, options.bodies);
+    report(
+        options.scenario,
+        {{"entities", options.bodies},
+         {"iterations", options.steps},
+         {"ns_per_entity", measurement.seconds * 1e9 / entityCount},
+         {"allocations_per_entity", measurement.allocations / entityCount},
+         {"component_reserved_bytes", double(reservedBytes)}},
+        measurement
+    );
+    return 0;
+}
+
+/* Shapes
+- Times each utils::Shapes generator at every subdivision level up to
+  options.level. For the UV sphere and cylinder, level n means 8 * 2^n
+  segments. Reports the time per generated mesh and per vertex. */
+int runShapes(const Options& options) {
+    namespace Shapes = omelette::utils::Shapes;
+
+    auto run = [&](const char* generator,
+                   unsigned int level,
+                   size_t vertexCount,
+                   const std::function<void()>& generate) {
+        generate();
+        const Measurement measurement = measure([&] {
+            for (unsigned int i = 0; i < options.steps; i++) {
+                generate();
+            }
+        });
+
+        const double iterations = options.steps;
+        report(
+            std::string("shapes/") + generator,
+            {{"level", level},
+             {"vertices", double(vertexCount)},
+             {"iterations", iterations},
+             {"ns_per_mesh", measurement.seconds * 1e9 / iterations},
+             {"ns_per_vertex",
+              measurement.seconds * 1e9 / (iterations * vertexCount)},
+             {"allocations_per_mesh", measurement.allocations / iterations}},
+            measurement
+        );
+    };
+
+    for (unsigned int level = 0; level <= options.level; level++) {
+        run("icosphere", level, Shapes::icosphereVertexCount(level), [&] {
+            Shapes::createIcosphere(1.0f, level);
+        });
+
+        const unsigned int segments = 8u << level;
+        run("uv-sphere",
+            level,
+            Shapes::uvSphereVertexCount(segments, segments),
+            [&] { Shapes::createUVSphere(1.0f, segments, segments); });
+        run("cylinder", level, Shapes::cylinderVertexCount(segments), [&] {
+            Shapes::createCylinder(1.0f, 1.0f, segments);
+        });
+    }
+    return 0;
+}
+
+/* Query
+- Spreads entities over four archetypes and times a one-component and a
+  two-component view over them. Reports the time per matched entity. */
+int runQuery(const Options& options) {
+    omelette::ecs::ECS ecs;
+    omelette::utils::MeshCache meshCache;
+    const auto mesh = meshCache.cube();
+    const auto shape = omelette::physics::Shape::box(Vec3(0.5f, 0.5f, 0.5f));
+
+    for (unsigned int i = 0; i < options.bodies; i++) {
+        auto entity = ecs.createEntity();
+        const Vec3 position(float(i), 0.0f, 0.0f);
+        ecs.addComponentToEntity(
+            entity,
+            RigidBodyComponent(position, Vec3(1.0f, 0.0f, 0.0f), Vec3(), 1.0f)
+        );
+        if (i % 2 == 1) {
+            ecs.addComponentToEntity(entity, MeshComponent(mesh));
+        }
+        if (i % 4 >= 2) {
+            ecs.addComponentToEntity(entity, ColliderComponent(shape));
+        }
+    }
+
+    // Keep the sums observable so the loops are not optimized away
+    volatile float sink = 0.0f;
+
+    auto run = [&](const char* query,
+                   size_t matches,
+                   const std::function<float()>& iterate) {
+        for (unsigned int i = 0; i < options.warmup; i++) {
+            sink = sink + iterate();
+        }
+        const Measurement measurement = measure([&] {
+            for (unsigned int i = 0; i < options.steps; i++) {
+                sink = sink + iterate();
+            }
+        });
+
+        const double visits = double(options.steps) * std::max<size_t>(
+            1,
+            matches
+        );
+        report(
+            std::string("query/") + query,
+            {{"entities", options.bodies},
+             {"matches", double(matches)},
+             {"iterations", options.steps},
+             {"ns_per_entity", measurement.seconds * 1e9 / visits}},
+            measurement
+        );
+    };
+
+    run("rigid-body", options.bodies, [&] {
+        float sum = 0.0f;
+        ecs.view<RigidBodyComponent>().each([&](RigidBodyComponent& body) {
+            body.position += body.velocity * 0.001f;
+            sum += body.position.x;
+        });
+        return sum;
+    });
+
+    run("rigid-body+mesh", options.bodies / 2, [&] {
+        float sum = 0.0f;
+        ecs.view<const RigidBodyComponent, const MeshComponent>().each(
+            [&](const RigidBodyComponent& body, const MeshComponent& mesh) {
+                sum += body.position.x + mesh.getTransform()[3][0];
+            }
+        );
+        return sum;
+    });
+    return 0;
+}
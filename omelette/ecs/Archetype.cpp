@@ -0,0 +1,182 @@
+#include "Archetype.hpp"
+
+#include <algorithm>
+
+namespace omelette::ecs {
+    /* Archetype Constructor
+    - Sorts the given columns by component type id to form the signature
+      and the column lookup table.
+    - Parameters:
+        - columnTypes: Pairs of component type id and empty column. */
+    Archetype::Archetype(
+        std::vector<std::pair<
+            omelette::ecs::ComponentTypeId,
+            std::unique_ptr<omelette::ecs::ComponentColumn>>> columnTypes
+    ) {
+        std::sort(
+            columnTypes.begin(),
+            columnTypes.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; }
+        );
+
+        columnIndices.fill(NO_COLUMN);
+        types.reserve(columnTypes.size());
+        columns.reserve(columnTypes.size());
+        for (auto& [type, column] : columnTypes) {
+            signature.add(type);
+            columnIndices[type] = static_cast<uint8_t>(columns.size());
+            types.push_back(type);
+            columns.push_back(std::move(column));
+        }
+    }
+
+    /* Get Signature
+    - Returns: The set of component types stored by the archetype. */
+    const Signature& Archetype::getSignature() const {
+        return signature;
+    }
+
+    /* Get Types
+    - Returns: The component type id of each column, in ascending order. */
+    const std::vector<omelette::ecs::ComponentTypeId>&
+    Archetype::getTypes() const {
+        return types;
+    }
+
+    /* Get Entities
+    - Returns: The entity owning each row of the archetype. */
+    const std::vector<omelette::ecs::Entity>& Archetype::getEntities() const {
+        return entities;
+    }
+
+    /* Size
+    - Returns: The number of rows (entities) in the archetype. */
+    size_t Archetype::size() const {
+        return entities.size();
+    }
+
+    /* Get Columns
+    - Returns: Every column of the archetype, parallel to getTypes(). */
+    const std::vector<std::unique_ptr<omelette::ecs::ComponentColumn>>&
+    Archetype::getColumns() const {
+        return columns;
+    }
+
+    /* Add Entity
+    - Appends a row for an entity. The caller pushes its components.
+    - Parameters:
+        - entity: The entity owning the new row.
+    - Returns: The index of the new row. */
+    size_t Archetype::addEntity(omelette::ecs::Entity entity) {
+        entities.push_back(entity);
+        return entities.size() - 1;
+    }
+
+    /* Remove Row
+    - Removes a row from every column by moving the last row into its place.
+    - Parameters:
+        - row: The row to remove.
+    - Returns: The entity now stored at the row, or a null entity if none. */
+    omelette::ecs::Entity Archetype::removeRow(size_t row) {
+        for (auto& column : columns) {
+            column->removeRow(row);
+        }
+
+        bool wasLast = row + 1 == entities.size();
+        entities[row] = entities.back();
+        entities.pop_back();
+        return wasLast ? omelette::ecs::Entity() : entities[row];
+    }
+
+    /* Move Row To
+    - Moves the components of a row into another archetype. Components the
+      destination does not store are destroyed; components it stores that
+      this archetype does not must be pushed by the caller afterwards.
+    - Parameters:
+        - row: The row to move.
+        - destination: The archetype receiving the row.
+    - Returns: The entity now stored at the row, or a null entity if none. */
+    omelette::ecs::Entity
+    Archetype::moveRowTo(size_t row, Archetype& destination) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            auto* target = destination.getColumn(types[i]);
+            if (target) {
+                columns[i]->moveRowTo(row, *target);
+            } else {
+                columns[i]->removeRow(row);
+            }
+        }
+
+        destination.addEntity(entities[row]);
+
+        bool wasLast = row + 1 == entities.size();
+        entities[row] = entities.back();
+        entities.pop_back();
+        return wasLast ? omelette::ecs::Entity() : entities[row];
+    }
+
+    /* Reserve
+    - Reserves storage in every column and the entity list.
+    - Parameters:
+        - capacity: The number of rows to reserve. */
+    void Archetype::reserve(size_t capacity) {
+        entities.reserve(capacity);
+        for (auto& column : columns) {
+            column->reserve(capacity);
+        }
+    }
+
+    /* Update
+    - Updates every component of the archetype, one column at a time.
+    - Parameters:
+        - deltaTime: Time elapsed since last update. */
+    void Archetype::update(float deltaTime) {
+        for (auto& column : columns) {
+            column->updateAll(deltaTime);
+        }
+    }
+
+    /* Get Add Edge
+    - Returns the cached archetype reached by adding a component type.
+    - Parameters:
+        - type: The component type id being added.
+    - Returns: The cached archetype, or nullptr if not cached yet. */
+    Archetype*
+    Archetype::getAddEdge(omelette::ecs::ComponentTypeId type) const {
+        return addEdges[type];
+    }
+
+    /* Set Add Edge
+    - Caches the archetype reached by adding a component type.
+    - Parameters:
+        - type: The component type id being added.
+        - archetype: The archetype storing this signature plus the type. */
+    void Archetype::setAddEdge(
+        omelette::ecs::ComponentTypeId type,
+        Archetype* archetype
+    ) {
+        addEdges[type] = archetype;
+    }
+
+    /* Get Remove Edge
+    - Returns the cached archetype reached by removing a component type.
+    - Parameters:
+        - type: The component type id being removed.
+    - Returns: The cached archetype, or nullptr if not cached yet. */
+    Archetype*
+    Archetype::getRemoveEdge(omelette::ecs::ComponentTypeId type) const {
+        return removeEdges[type];
+    }
+
+    /* Set Remove Edge
+    - Caches the archetype reached by removing a component type.
+    - Parameters:
+        - type: The component type id being removed.
+        - archetype: The archetype storing this signature minus the type. */
+    void Archetype::setRemoveEdge(
+        omelette::ecs::ComponentTypeId type,
+        Archetype* archetype
+    ) {
+        removeEdges[type] = archetype;
+    }
+}; // namespace omelette::ecs
@@ -0,0 +1,203 @@
+#ifndef OMELETTE_ECS_ARCHETYPE_HPP
+#define OMELETTE_ECS_ARCHETYPE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ComponentColumn.hpp"
+#include "ComponentType.hpp"
+#include "Entity.hpp"
+
+namespace omelette::ecs {
+    // Table of every entity sharing one exact set of component types. Each
+    // component type is stored in its own contiguous column, and row i of
+    // every column belongs to the entity at index i.
+    class Archetype {
+      public:
+        // Marks a type id with no column in columnIndices
+        static constexpr uint8_t NO_COLUMN = UINT8_MAX;
+        static_assert(MAX_COMPONENT_TYPES < NO_COLUMN, "Column index overflow");
+
+      private:
+        // Component types stored by this archetype
+        Signature signature;
+
+        // Type id of each column, in ascending order
+        std::vector<omelette::ecs::ComponentTypeId> types;
+
+        // Column of each component type id, or NO_COLUMN
+        std::array<uint8_t, MAX_COMPONENT_TYPES> columnIndices;
+
+        // Entity owning each row
+        std::vector<omelette::ecs::Entity> entities;
+
+        // One column per component type, parallel to types
+        std::vector<std::unique_ptr<omelette::ecs::ComponentColumn>> columns;
+
+        // Cached archetypes reached by adding or removing each type id
+        std::array<Archetype*, MAX_COMPONENT_TYPES> addEdges{};
+        std::array<Archetype*, MAX_COMPONENT_TYPES> removeEdges{};
+
+      public:
+        // Construct from (type id, empty column) pairs in any order
+        explicit Archetype(
+            std::vector<std::pair<
+                omelette::ecs::ComponentTypeId,
+                std::unique_ptr<omelette::ecs::ComponentColumn>>> columnTypes
+        );
+
+        // Get the component types stored by this archetype
+        const Signature& getSignature() const;
+
+        // Get the type id of each column, in ascending order
+        const std::vector<omelette::ecs::ComponentTypeId>& getTypes() const;
+
+        // Get the entity owning each row
+        const std::vector<omelette::ecs::Entity>& getEntities() const;
+
+        // Number of rows (entities) in the archetype
+        size_t size() const;
+
+        // Check whether the archetype stores a component type
+        bool hasComponent(omelette::ecs::ComponentTypeId type) const;
+
+        template<typename T>
+        bool hasComponent() const;
+
+        // Check whether the archetype stores every type of a signature
+        bool matches(const Signature& query) const;
+
+        // Get the type-erased column for a component type, or nullptr
+        omelette::ecs::ComponentColumn*
+        getColumn(omelette::ecs::ComponentTypeId type);
+        const omelette::ecs::ComponentColumn*
+        getColumn(omelette::ecs::ComponentTypeId type) const;
+
+        // Get the typed column for a component type, or nullptr
+        template<typename T>
+        omelette::ecs::TypedColumn<T>* getColumn();
+
+        // Get all columns, parallel to getTypes()
+        const std::vector<std::unique_ptr<omelette::ecs::ComponentColumn>>&
+        getColumns() const;
+
+        // Get the typed component array for a component type, or nullptr
+        template<typename T>
+        std::vector<T>* getComponents();
+
+        template<typename T>
+        const std::vector<T>* getComponents() const;
+
+        // Append an entity row; its components must be pushed by the caller
+        size_t addEntity(omelette::ecs::Entity entity);
+
+        // Swap-and-pop a row out of every column. Returns the entity that was
+        // moved into the row, or a null entity if the last row was removed.
+        omelette::ecs::Entity removeRow(size_t row);
+
+        // Move a row's shared components into another archetype, dropping
+        // the ones it does not store. Returns the entity that was moved into
+        // the vacated row, or a null entity if the last row was moved.
+        omelette::ecs::Entity moveRowTo(size_t row, Archetype& destination);
+
+        // Reserve storage in every column
+        void reserve(size_t capacity);
+
+        // Update every component of every row
+        void update(float deltaTime);
+
+        // Cached transition when adding a component type
+        Archetype* getAddEdge(omelette::ecs::ComponentTypeId type) const;
+        void
+        setAddEdge(omelette::ecs::ComponentTypeId type, Archetype* archetype);
+
+        // Cached transition when removing a component type
+        Archetype* getRemoveEdge(omelette::ecs::ComponentTypeId type) const;
+        void setRemoveEdge(
+            omelette::ecs::ComponentTypeId type,
+            Archetype* archetype
+        );
+    };
+
+    /* Has Component
+    - Checks whether the archetype stores a component type.
+    - Parameters:
+        - type: The component type id to look for.
+    - Returns: True if the archetype has a column for the type. */
+    inline bool
+    Archetype::hasComponent(omelette::ecs::ComponentTypeId type) const {
+        return signature.has(type);
+    }
+
+    /* Matches
+    - Checks whether the archetype stores every component type of a query,
+      with a single AND-and-compare of the bit sets.
+    - Parameters:
+        - query: The component types to look for.
+    - Returns: True if the query is a subset of the signature. */
+    inline bool Archetype::matches(const Signature& query) const {
+        return signature.contains(query);
+    }
+
+    /* Get Column
+    - Looks up the column storing a component type in a flat table.
+    - Parameters:
+        - type: The component type id to look for.
+    - Returns: The column, or nullptr if the archetype does not store it. */
+    inline omelette::ecs::ComponentColumn*
+    Archetype::getColumn(omelette::ecs::ComponentTypeId type) {
+        const uint8_t index = columnIndices[type];
+        return index != NO_COLUMN ? columns[index].get() : nullptr;
+    }
+
+    inline const omelette::ecs::ComponentColumn*
+    Archetype::getColumn(omelette::ecs::ComponentTypeId type) const {
+        return const_cast<Archetype*>(this)->getColumn(type);
+    }
+
+    /* Has Component
+    - Checks whether the archetype stores a component type.
+    - Template Parameters:
+        - T: The component type to look for.
+    - Returns: True if the archetype has a column for T. */
+    template<typename T>
+    bool Archetype::hasComponent() const {
+        return hasComponent(omelette::ecs::getComponentTypeId<T>());
+    }
+
+    /* Get Column
+    - Returns the column storing a component type, to add components
+      through it.
+    - Template Parameters:
+        - T: The component type to get.
+    - Returns: Pointer to the column, or nullptr if absent. */
+    template<typename T>
+    omelette::ecs::TypedColumn<T>* Archetype::getColumn() {
+        return static_cast<omelette::ecs::TypedColumn<T>*>(
+            getColumn(omelette::ecs::getComponentTypeId<T>())
+        );
+    }
+
+    /* Get Components
+    - Returns the contiguous array of components of a given type.
+    - Template Parameters:
+        - T: The component type to get.
+    - Returns: Pointer to the component array, or nullptr if absent. */
+    template<typename T>
+    std::vector<T>* Archetype::getComponents() {
+        auto* column = getColumn<T>();
+        return column ? &column->data : nullptr;
+    }
+
+    template<typename T>
+    const std::vector<T>* Archetype::getComponents() const {
+        const auto* column = const_cast<Archetype*>(this)->getColumn<T>();
+        return column ? &column->data : nullptr;
+    }
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_ARCHETYPE_HPP
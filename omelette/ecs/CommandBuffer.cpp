@@ -0,0 +1,49 @@
+#include "CommandBuffer.hpp"
+
+namespace omelette::ecs {
+    /* CommandBuffer Destructor
+    - Drops the commands that were never applied. */
+    CommandBuffer::~CommandBuffer() {
+        clear();
+    }
+
+    /* Destroy Entity
+    - Records destroying an entity and its components.
+    - Parameters:
+        - entity: The entity to destroy. */
+    void CommandBuffer::destroyEntity(omelette::ecs::Entity entity) {
+        record([entity](omelette::ecs::ECS& ecs) {
+            ecs.destroyEntity(entity);
+        });
+    }
+
+    /* Apply
+    - Runs every command on an ECS in recording order, then clears the
+      buffer and rewinds its arena.
+    - Parameters:
+        - ecs: The ECS to change. */
+    void CommandBuffer::apply(omelette::ecs::ECS& ecs) {
+        OMELETTE_PROFILE_ZONE("CommandBuffer::apply");
+        for (const auto& command : commands) {
+            command.apply(ecs, command.payload);
+        }
+        clear();
+    }
+
+    /* Clear
+    - Destroys every recorded command without running it. */
+    void CommandBuffer::clear() {
+        for (const auto& command : commands) {
+            command.destroy(command.payload);
+        }
+        commands.clear();
+        arena.reset();
+    }
+
+    /* Size
+    - Returns: The number of commands recorded since the last apply. */
+    size_t CommandBuffer::size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return commands.size();
+    }
+}; // namespace omelette::ecs
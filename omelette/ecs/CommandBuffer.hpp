@@ -0,0 +1,146 @@
+#ifndef OMELETTE_ECS_COMMANDBUFFER_HPP
+#define OMELETTE_ECS_COMMANDBUFFER_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../utils/FrameArena.hpp"
+#include "ECS.hpp"
+#include "Entity.hpp"
+
+namespace omelette::ecs {
+    // Structural changes recorded now and applied later, when nothing is
+    // iterating the ECS: from inside view().each, or from systems running
+    // in parallel, which must not move rows under each other. Recording is
+    // thread-safe and commands apply in the order they were recorded.
+    // Commands are stored in an arena, so once the buffer has warmed up
+    // recording does not call malloc.
+    class CommandBuffer {
+      private:
+        // Function object stored in the arena, run as apply(ecs, payload)
+        struct Command {
+            void (*apply)(omelette::ecs::ECS& ecs, void* payload);
+            void (*destroy)(void* payload);
+            void* payload;
+        };
+
+        omelette::utils::FrameArena arena;
+        std::vector<Command> commands;
+        mutable std::mutex mutex;
+
+        // Store a function object to run as function(ecs) on apply
+        template<typename Function>
+        void record(Function&& function);
+
+      public:
+        CommandBuffer() = default;
+        ~CommandBuffer();
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // Create count entities, each with a copy of the given components
+        template<typename... Ts>
+        void createEntities(size_t count, Ts... components);
+
+        // Destroy an entity; stale handles are ignored
+        void destroyEntity(omelette::ecs::Entity entity);
+
+        // Add or replace a component; stale handles are ignored
+        template<typename T>
+        void addComponentToEntity(omelette::ecs::Entity entity, T component);
+
+        // Remove a component; stale handles are ignored
+        template<typename T>
+        void removeComponentFromEntity(omelette::ecs::Entity entity);
+
+        // Apply every command in recording order, then clear the buffer.
+        // Must not run while commands are being recorded.
+        void apply(omelette::ecs::ECS& ecs);
+
+        // Drop every command without applying it
+        void clear();
+
+        // Number of recorded commands
+        size_t size() const;
+    };
+
+    /* Record
+    - Moves a function object into the arena and queues it.
+    - Template Parameters:
+        - Function: Callable as function(ECS&).
+    - Parameters:
+        - function: The command to run on apply. */
+    template<typename Function>
+    void CommandBuffer::record(Function&& function) {
+        using Stored = std::decay_t<Function>;
+        void* payload = arena.allocate(sizeof(Stored), alignof(Stored));
+        new (payload) Stored(std::forward<Function>(function));
+
+        const Command command{
+            [](omelette::ecs::ECS& ecs, void* stored) {
+                (*static_cast<Stored*>(stored))(ecs);
+            },
+            [](void* stored) { static_cast<Stored*>(stored)->~Stored(); },
+            payload
+        };
+        std::lock_guard<std::mutex> lock(mutex);
+        commands.push_back(command);
+    }
+
+    /* Create Entities
+    - Records the creation of a batch of entities; see ECS::createEntities.
+    - Template Parameters:
+        - Ts: The component types, each at most once.
+    - Parameters:
+        - count: The number of entities to create.
+        - components: The components copied into every entity. */
+    template<typename... Ts>
+    void CommandBuffer::createEntities(size_t count, Ts... components) {
+        record([count, components...](omelette::ecs::ECS& ecs) {
+            ecs.createEntities(count, components...);
+        });
+    }
+
+    /* Add Component To Entity
+    - Records adding a component. Skipped if the entity is gone by the
+      time the buffer is applied.
+    - Template Parameters:
+        - T: The component type to add.
+    - Parameters:
+        - entity: The entity to add the component to.
+        - component: The component to add. */
+    template<typename T>
+    void CommandBuffer::addComponentToEntity(
+        omelette::ecs::Entity entity,
+        T component
+    ) {
+        record([entity, component = std::move(component)](
+                   omelette::ecs::ECS& ecs
+               ) mutable {
+            if (ecs.isAlive(entity)) {
+                ecs.addComponentToEntity(entity, std::move(component));
+            }
+        });
+    }
+
+    /* Remove Component From Entity
+    - Records removing a component.
+    - Template Parameters:
+        - T: The component type to remove.
+    - Parameters:
+        - entity: The entity to remove the component from. */
+    template<typename T>
+    void
+    CommandBuffer::removeComponentFromEntity(omelette::ecs::Entity entity) {
+        record([entity](omelette::ecs::ECS& ecs) {
+            ecs.removeComponentFromEntity<T>(entity);
+        });
+    }
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_COMMANDBUFFER_HPP
@@ -0,0 +1,159 @@
+#ifndef OMELETTE_ECS_COMPONENTCOLUMN_HPP
+#define OMELETTE_ECS_COMPONENTCOLUMN_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Component.hpp"
+#include "ComponentStats.hpp"
+
+namespace omelette::ecs {
+    // Type-erased, contiguous storage for one component type of an archetype
+    class ComponentColumn {
+      public:
+        // Virtual destructor for polymorphic deletion
+        virtual ~ComponentColumn() = default;
+
+        // Create an empty column storing the same component type
+        virtual std::unique_ptr<ComponentColumn> createEmpty() const = 0;
+
+        // Number of components stored in the column
+        virtual size_t size() const = 0;
+
+        // Reserve storage for a number of components
+        virtual void reserve(size_t capacity) = 0;
+
+        // Release storage beyond the components stored
+        virtual void shrinkToFit() = 0;
+
+        // Access the component stored at a row through its base class
+        virtual omelette::ecs::Component& get(size_t row) = 0;
+        virtual const omelette::ecs::Component& get(size_t row) const = 0;
+
+        // Move the component at a row to the end of another column of the
+        // same type, then swap-and-pop it out of this column
+        virtual void moveRowTo(size_t row, ComponentColumn& destination) = 0;
+
+        // Swap-and-pop the component at a row out of the column
+        virtual void removeRow(size_t row) = 0;
+
+        // Update every component in the column
+        virtual void updateAll(float deltaTime) = 0;
+    };
+
+    // Column storing components of type T by value in one contiguous array.
+    // Every column of a type reports to the same ComponentStats, if given;
+    // components must be added and removed through the column, not data.
+    template<typename T>
+    class TypedColumn: public ComponentColumn {
+        static_assert(
+            std::is_base_of_v<omelette::ecs::Component, T>,
+            "Column types must derive from omelette::ecs::Component"
+        );
+
+      private:
+        omelette::ecs::ComponentStats* stats;
+
+        // Report the change of size and capacity since the given values
+        void track(size_t oldSize, size_t oldCapacity) {
+            if (!stats) {
+                return;
+            }
+            stats->liveCount = stats->liveCount + data.size() - oldSize;
+            stats->reservedCount =
+                stats->reservedCount + data.capacity() - oldCapacity;
+            if (stats->liveCount > stats->highWaterMark) {
+                stats->highWaterMark = stats->liveCount;
+            }
+        }
+
+        // Move the last component into a row and drop the last row
+        void swapAndPop(size_t row) {
+            if (row + 1 != data.size()) {
+                data[row] = std::move(data.back());
+            }
+            data.pop_back();
+        }
+
+      public:
+        std::vector<T> data; // Components, indexed by archetype row
+
+        explicit TypedColumn(omelette::ecs::ComponentStats* stats = nullptr) :
+            stats(stats) {}
+
+        ~TypedColumn() override {
+            if (stats) {
+                stats->liveCount -= data.size();
+                stats->reservedCount -= data.capacity();
+            }
+        }
+
+        TypedColumn(const TypedColumn&) = delete;
+        TypedColumn& operator=(const TypedColumn&) = delete;
+
+        std::unique_ptr<ComponentColumn> createEmpty() const override {
+            return std::make_unique<TypedColumn<T>>(stats);
+        }
+
+        size_t size() const override {
+            return data.size();
+        }
+
+        void reserve(size_t capacity) override {
+            const size_t oldCapacity = data.capacity();
+            data.reserve(capacity);
+            track(data.size(), oldCapacity);
+        }
+
+        void shrinkToFit() override {
+            const size_t oldCapacity = data.capacity();
+            data.shrink_to_fit();
+            track(data.size(), oldCapacity);
+        }
+
+        // Append a component and return it
+        T& push(T component) {
+            const size_t oldSize = data.size();
+            const size_t oldCapacity = data.capacity();
+            data.push_back(std::move(component));
+            track(oldSize, oldCapacity);
+            return data.back();
+        }
+
+        omelette::ecs::Component& get(size_t row) override {
+            return data[row];
+        }
+
+        const omelette::ecs::Component& get(size_t row) const override {
+            return data[row];
+        }
+
+        void moveRowTo(size_t row, ComponentColumn& destination) override {
+            // The component changes column, so only capacity is tracked
+            auto& target = static_cast<TypedColumn<T>&>(destination);
+            const size_t oldCapacity = target.data.capacity();
+            target.data.push_back(std::move(data[row]));
+            target.track(target.data.size(), oldCapacity);
+            swapAndPop(row);
+        }
+
+        void removeRow(size_t row) override {
+            swapAndPop(row);
+            if (stats) {
+                stats->liveCount--;
+            }
+        }
+
+        void updateAll(float deltaTime) override {
+            // Qualified call so the compiler can devirtualize the loop body
+            for (auto& component : data) {
+                component.T::update(deltaTime);
+            }
+        }
+    };
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_COMPONENTCOLUMN_HPP
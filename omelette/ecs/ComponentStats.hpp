@@ -0,0 +1,30 @@
+#ifndef OMELETTE_ECS_COMPONENTSTATS_HPP
+#define OMELETTE_ECS_COMPONENTSTATS_HPP
+
+#include <cstddef>
+
+#include "ComponentType.hpp"
+
+namespace omelette::ecs {
+    // Memory use of one component type, summed over every archetype column
+    // storing it. Kept up to date by the columns on each structural change.
+    struct ComponentStats {
+        omelette::ecs::ComponentTypeId type = 0; // Id of the type
+        size_t componentSize = 0; // Bytes per component
+        size_t liveCount = 0; // Components currently stored
+        size_t highWaterMark = 0; // Most components stored at once
+        size_t reservedCount = 0; // Components the columns have room for
+
+        // Bytes of the components currently stored
+        size_t getLiveBytes() const {
+            return liveCount * componentSize;
+        }
+
+        // Bytes held by the columns, including unused capacity
+        size_t getReservedBytes() const {
+            return reservedCount * componentSize;
+        }
+    };
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_COMPONENTSTATS_HPP
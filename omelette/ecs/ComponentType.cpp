@@ -0,0 +1,29 @@
+#include "ComponentType.hpp"
+
+#include <stdexcept>
+
+namespace omelette::ecs {
+    std::atomic<ComponentTypeId> ComponentRegistry::nextId{0};
+
+    /* Register Type
+    - Assigns the next free component type id. Called once per type by
+      getComponentTypeId, from any thread.
+    - Returns: The new id. */
+    ComponentTypeId ComponentRegistry::registerType() {
+        const ComponentTypeId id =
+            nextId.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MAX_COMPONENT_TYPES) {
+            throw std::length_error(
+                "ComponentRegistry: more than MAX_COMPONENT_TYPES types"
+            );
+        }
+        return id;
+    }
+
+    /* Get Type Count
+    - Returns: The number of component type ids assigned so far. */
+    size_t ComponentRegistry::getTypeCount() {
+        const size_t count = nextId.load(std::memory_order_relaxed);
+        return count < MAX_COMPONENT_TYPES ? count : MAX_COMPONENT_TYPES;
+    }
+}; // namespace omelette::ecs
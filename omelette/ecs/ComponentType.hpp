@@ -0,0 +1,129 @@
+#ifndef OMELETTE_ECS_COMPONENTTYPE_HPP
+#define OMELETTE_ECS_COMPONENTTYPE_HPP
+
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace omelette::ecs {
+    // Dense id of a component type, assigned the first time it is used
+    using ComponentTypeId = uint32_t;
+
+    // Component types a program can use; the width of a Signature
+    constexpr size_t MAX_COMPONENT_TYPES = 64;
+
+    // Hands out component type ids in order of first use, so they index
+    // flat arrays and bit sets instead of hashing std::type_index.
+    class ComponentRegistry {
+      public:
+        // Assign the next id; throws std::length_error once every id of
+        // MAX_COMPONENT_TYPES is taken
+        static ComponentTypeId registerType();
+
+        // Number of ids assigned so far
+        static size_t getTypeCount();
+
+      private:
+        static std::atomic<ComponentTypeId> nextId;
+    };
+
+    // Id of a component type; const and non-const T share one id
+    template<typename T>
+    ComponentTypeId getComponentTypeId() {
+        if constexpr (!std::is_same_v<T, std::remove_cv_t<T>>) {
+            return getComponentTypeId<std::remove_cv_t<T>>();
+        } else {
+            static const ComponentTypeId id = ComponentRegistry::registerType();
+            return id;
+        }
+    }
+
+    // Set of component types as one bit per type id. Checking a type is a
+    // bit test and matching a query is a single AND-and-compare.
+    class Signature {
+      private:
+        std::bitset<MAX_COMPONENT_TYPES> bits;
+
+      public:
+        // Add or remove a type
+        Signature& add(ComponentTypeId type) {
+            bits[type] = true;
+            return *this;
+        }
+
+        Signature& remove(ComponentTypeId type) {
+            bits[type] = false;
+            return *this;
+        }
+
+        // Add every type of another signature
+        Signature& merge(const Signature& other) {
+            bits |= other.bits;
+            return *this;
+        }
+
+        // Check whether a type is in the set
+        bool has(ComponentTypeId type) const {
+            return bits[type];
+        }
+
+        // Check whether every type of another signature is in the set
+        bool contains(const Signature& other) const {
+            return (bits & other.bits) == other.bits;
+        }
+
+        // Check whether the signatures share a type
+        bool intersects(const Signature& other) const {
+            return (bits & other.bits).any();
+        }
+
+        // Number of types in the set
+        size_t count() const {
+            return bits.count();
+        }
+
+        // Visit every type in ascending id order
+        template<typename Function>
+        void forEach(Function&& function) const {
+            for (ComponentTypeId type = 0; type < MAX_COMPONENT_TYPES; type++) {
+                if (bits[type]) {
+                    function(type);
+                }
+            }
+        }
+
+        bool operator==(const Signature& other) const {
+            return bits == other.bits;
+        }
+
+        bool operator!=(const Signature& other) const {
+            return bits != other.bits;
+        }
+
+        size_t hash() const {
+            return std::hash<std::bitset<MAX_COMPONENT_TYPES>>()(bits);
+        }
+    };
+
+    // Build the signature of a list of component types
+    template<typename... Ts>
+    Signature makeSignature() {
+        Signature signature;
+        (signature.add(getComponentTypeId<Ts>()), ...);
+        return signature;
+    }
+}; // namespace omelette::ecs
+
+namespace std {
+    template<>
+    struct hash<omelette::ecs::Signature> {
+        size_t operator()(const omelette::ecs::Signature& signature) const {
+            return signature.hash();
+        }
+    };
+}; // namespace std
+
+#endif // OMELETTE_ECS_COMPONENTTYPE_HPP
@@ -0,0 +1,23 @@
+#include "ColliderComponent.hpp"
+
+namespace omelette::ecs::components {
+    /* ColliderComponent Constructor
+    - Sets the collider's shape. Hull shapes share their hull data. */
+    ColliderComponent::ColliderComponent(const physics::Shape& shape) :
+        shape(shape) {}
+
+    /* Update
+        - Colliders have no per-frame state.
+        - Parameters:
+            - deltaTime: Time elapsed since last update */
+    void ColliderComponent::update(float deltaTime) {
+        // No default update behavior
+    }
+
+    /* Clone
+        - Creates a copy of the collider component.
+        - Returns: A unique pointer to the copied component. */
+    std::unique_ptr<omelette::ecs::Component> ColliderComponent::clone() const {
+        return std::make_unique<ColliderComponent>(*this);
+    }
+}; // namespace omelette::ecs::components
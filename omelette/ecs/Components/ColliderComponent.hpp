@@ -0,0 +1,25 @@
+#ifndef OMELETTE_ECS_COMPONENTS_COLLIDERCOMPONENT_HPP
+#define OMELETTE_ECS_COMPONENTS_COLLIDERCOMPONENT_HPP
+
+#include <memory>
+
+#include "../../physics/Shape.hpp"
+#include "../Component.hpp"
+
+namespace omelette::ecs::components {
+    class ColliderComponent: public omelette::ecs::Component {
+      public:
+        physics::Shape shape; // Convex shape, centered on the rigid body
+
+        // Parameterized constructor
+        explicit ColliderComponent(const physics::Shape& shape);
+
+        // Colliders have no per-frame state
+        void update(float deltaTime) override;
+
+        // Clone function for copying components
+        std::unique_ptr<Component> clone() const override;
+    };
+}; // namespace omelette::ecs::components
+
+#endif // OMELETTE_ECS_COMPONENTS_COLLIDERCOMPONENT_HPP
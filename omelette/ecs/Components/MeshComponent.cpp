@@ -1,15 +1,33 @@
 #include "MeshComponent.hpp"
 
-#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <memory>
+#include <utility>
+
+#include "../../utils/Profiler.hpp"
+#include "../../utils/VertexTransform.hpp"
 
 namespace omelette::ecs::components {
+    /* MeshComponent Constructor
+        - Creates an instance of shared geometry at the identity transform. Instances share the
+          geometry, so spawning one copies no vertices.
+        - Parameters:
+            - mesh: The shared rest-pose geometry */
+    MeshComponent::MeshComponent(utils::MeshHandle mesh) :
+        mesh(std::move(mesh)),
+        worldTransform(1.0f) {}
+
+    /* MeshComponent Constructor
+        - Copies the given geometry into a mesh of its own, so later changes to the vectors do not
+          affect the component. Use a utils::MeshCache to share geometry between instances.
+        - Parameters:
+            - vertices: The rest-pose vertices
+            - indices: The triangle indices, narrowed to 16 bits if there are few enough vertices */
     MeshComponent::MeshComponent(
-        std::vector<utils::Vec3>& vertices,
-        const std::vector<uintptr_t>& indices
+        const std::vector<utils::Vec3>& vertices,
+        utils::IndexBuffer indices
     ) :
-        vertices(vertices),
-        indices(indices) {}
+        MeshComponent(utils::makeMesh(vertices, std::move(indices))) {}
 
     /* Update
         - Updates the mesh component's state based on elapsed time.
@@ -19,23 +37,22 @@ namespace omelette::ecs::components {
         // No default update behavior
     }
 
+    /* Set Transform
+        - Replaces the transformation from the rest pose to world space. The vertices are not
+          touched until they are next requested.
+        - Parameters:
+            - transformMatrix: 4x4 matrix from rest pose to world space */
+    void MeshComponent::setTransform(const glm::mat4& transformMatrix) {
+        worldTransform = transformMatrix;
+        worldDirty = true;
+    }
+
     /* Transform
-        - Applies a transformation matrix to all vertices in the mesh.
+        - Applies a transformation matrix on top of the current world transform.
         - Parameters:
             - transformMatrix: 4x4 matrix defining the transformation to apply */
     void MeshComponent::transform(const glm::mat4& transformMatrix) {
-        for (auto& vertex : vertices) {
-            // Convert Vec3 to glm::vec4 for transformation (w = 1.0 for position)
-            glm::vec4 v(vertex.x, vertex.y, vertex.z, 1.0f);
-
-            // Apply transformation
-            v = transformMatrix * v;
-
-            // Convert back to Vec3
-            vertex.x = v.x;
-            vertex.y = v.y;
-            vertex.z = v.z;
-        }
+        setTransform(transformMatrix * worldTransform);
     }
 
     /* Clone
@@ -45,17 +62,86 @@ namespace omelette::ecs::components {
         return std::make_unique<MeshComponent>(*this);
     }
 
+    /* Get Transform
+        - Returns: The transformation from the rest pose to world space */
+    const glm::mat4& MeshComponent::getTransform() const {
+        return worldTransform;
+    }
+
+    /* Get Mesh
+        - Returns: The shared geometry of this instance */
+    const utils::MeshHandle& MeshComponent::getMesh() const {
+        return mesh;
+    }
+
+    /* Get Local Vertices
+        - Returns: Constant reference to the rest-pose vertices */
+    const std::vector<utils::Vec3>& MeshComponent::getLocalVertices() const {
+        return mesh->vertices;
+    }
+
     /* Get Vertices
-        - Retrieves the mesh's vertex data.
+        - Retrieves the mesh's world-space vertices, transforming the rest pose with the SIMD batch
+          kernel first if the transform changed since the last call.
         - Returns: Constant reference to the vector of vertices */
     const std::vector<utils::Vec3>& MeshComponent::getVertices() const {
-        return vertices;
+        if (!worldDirty) {
+            return worldVertices;
+        }
+
+        const auto& localVertices = mesh->vertices;
+        worldVertices.resize(localVertices.size());
+        utils::VertexTransform::transform(
+            worldTransform,
+            localVertices.data(),
+            worldVertices.data(),
+            localVertices.size()
+        );
+        worldDirty = false;
+        OMELETTE_PROFILE_COUNTER("vertices transformed", localVertices.size());
+        return worldVertices;
     }
 
     /* Get Indices
-        - Retrieves the mesh's index data.
-        - Returns: Constant reference to the vector of indices */
-    const std::vector<uintptr_t>& MeshComponent::getIndices() const {
-        return indices;
+        - Retrieves the mesh's index data, 16 or 32 bits wide depending on the vertex count.
+        - Returns: Constant reference to the index buffer */
+    const utils::IndexBuffer& MeshComponent::getIndices() const {
+        return mesh->indices;
+    }
+
+    /* Get Bounds
+        - Transforms the rest-pose bounds into a world-space box containing the mesh. Each output
+          extent gathers the larger of the two products of a matrix entry with the box's ends, so
+          no vertex is visited (Arvo's method). The box is exact for translations and scales.
+        - Returns: The world-space AABB */
+    utils::AABB MeshComponent::getBounds() const {
+        const utils::AABB& localBounds = mesh->bounds;
+        const float localMin[3] = {
+            localBounds.min.x,
+            localBounds.min.y,
+            localBounds.min.z
+        };
+        const float localMax[3] = {
+            localBounds.max.x,
+            localBounds.max.y,
+            localBounds.max.z
+        };
+
+        float worldMin[3];
+        float worldMax[3];
+        for (int row = 0; row < 3; row++) {
+            worldMin[row] = worldMax[row] = worldTransform[3][row];
+            for (int column = 0; column < 3; column++) {
+                const float a = worldTransform[column][row] * localMin[column];
+                const float b = worldTransform[column][row] * localMax[column];
+                worldMin[row] += std::min(a, b);
+                worldMax[row] += std::max(a, b);
+            }
+        }
+
+        return utils::AABB(
+            utils::Vec3(worldMin[0], worldMin[1], worldMin[2]),
+            utils::Vec3(worldMax[0], worldMax[1], worldMax[2])
+        );
     }
 } // namespace omelette::ecs::components
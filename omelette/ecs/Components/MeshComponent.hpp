@@ -5,30 +5,58 @@
 #include <memory>
 #include <vector>
 
+#include "../../utils/AABB.hpp"
+#include "../../utils/IndexBuffer.hpp"
+#include "../../utils/MeshCache.hpp"
 #include "../../utils/Vec3.hpp"
 #include "../Component.hpp"
 
 namespace omelette::ecs::components {
+    // Instance of shared, immutable mesh geometry with its own world
+    // transform. Moving the mesh only replaces the transform; world-space
+    // vertices are computed when first asked for after a change, so a mesh
+    // nobody reads costs O(1) per move. The cache makes getVertices()
+    // unsafe to call on the same mesh from several threads at once.
     class MeshComponent: public omelette::ecs::Component {
+      private:
+        utils::MeshHandle mesh; // Shared rest-pose geometry
+        glm::mat4 worldTransform; // Rest pose to world space
+
+        // World-space vertices, valid unless worldDirty is set
+        mutable std::vector<utils::Vec3> worldVertices;
+        mutable bool worldDirty = true;
+
       public:
-        std::vector<utils::Vec3>& vertices; // Vertex buffer object (VBO)
-        const std::vector<uintptr_t>& indices; // Element buffer object (EBO)
+        // Instance of shared geometry, e.g. from a utils::MeshCache
+        explicit MeshComponent(utils::MeshHandle mesh);
 
+        // Instance of a private copy of the given geometry
         MeshComponent(
-            std::vector<utils::Vec3>& vertices,
-            const std::vector<uintptr_t>& indices
+            const std::vector<utils::Vec3>& vertices,
+            utils::IndexBuffer indices
         );
 
         // Update the mesh's vertices
         void update(float deltaTime) override;
+
+        // Replace the world transform
+        void setTransform(const glm::mat4& transformMatrix);
+
+        // Apply a transformation on top of the current world transform
         void transform(const glm::mat4& transformMatrix);
 
         // Clone function for copying components
         std::unique_ptr<Component> clone() const override;
 
         // Getters for shape data
+        const glm::mat4& getTransform() const;
+        const utils::MeshHandle& getMesh() const;
+        const std::vector<utils::Vec3>& getLocalVertices() const;
         const std::vector<utils::Vec3>& getVertices() const;
-        const std::vector<uintptr_t>& getIndices() const;
+        const utils::IndexBuffer& getIndices() const;
+
+        // World-space bounds, from the rest-pose bounds in O(1)
+        utils::AABB getBounds() const;
     };
 } // namespace omelette::ecs::components
 
@@ -1,49 +1,37 @@
 #include "RigidBodyComponent.hpp"
 
-#include <glm/gtc/matrix_transform.hpp>
-
-#include "ecs/Components/MeshComponent.hpp"
-
 namespace omelette::ecs::components {
     /* RigidBodyComponent Constructor
     - Sets the rigid body's position, velocity, acceleration, and mass to the given values.
-    - Initializes the shape data with the given vertices and indices. */
+    - The body's mesh, if any, is the MeshComponent of the same entity. */
     RigidBodyComponent::RigidBodyComponent(
         const utils::Vec3& position,
         const utils::Vec3& velocity,
         const utils::Vec3& acceleration,
-        float mass,
-        MeshComponent* meshComponent
+        float mass
     ) :
         position(position),
+        previousPosition(position),
         velocity(velocity),
         acceleration(acceleration),
-        mass(mass),
-        meshComponent(meshComponent) {}
+        mass(mass) {}
 
     /* Update
         - Updates the rigid body's position and velocity based on the current acceleration and time step.
         - Parameters:
             - deltaTime: The time step to update the rigid body by. */
     void RigidBodyComponent::update(float deltaTime) {
+        // Sleeping bodies are at rest
+        if (sleeping) {
+            return;
+        }
+
         // Update velocity based on acceleration
         velocity += acceleration * deltaTime;
 
         // Update position based on velocity
         position += velocity * deltaTime;
 
-        // Create transformation matrix
-        glm::mat4 transform = glm::mat4(1.0f);
-        transform = glm::translate(
-            transform,
-            glm::vec3(position.x, position.y, position.z)
-        );
-
-        // Update mesh component with new transform
-        if (meshComponent) {
-            meshComponent->transform(transform);
-        }
-
         // Reset acceleration to zero
         acceleration = utils::Vec3();
     }
@@ -58,9 +46,35 @@ namespace omelette::ecs::components {
 
     /* Apply Force
     - Applies a force to the rigid body by adding the force divided by the mass to the acceleration.
+    - A sleeping body is woken first, unless wake is false, in which case the force is dropped so it
+      does not build up while the body sleeps. Pass false for forces applied every tick, such as gravity.
     - Parameters:
-        - force: The force to apply to the rigid body. */
-    void RigidBodyComponent::applyForce(const utils::Vec3& force) {
+        - force: The force to apply to the rigid body.
+        - wake: Whether to wake the body if it is sleeping. */
+    void RigidBodyComponent::applyForce(const utils::Vec3& force, bool wake) {
+        if (sleeping) {
+            if (!wake) {
+                return;
+            }
+            this->wake();
+        }
         acceleration += force / mass;
     }
+
+    /* Wake
+    - Wakes the rigid body and resets its sleep timer. */
+    void RigidBodyComponent::wake() {
+        sleeping = false;
+        sleepTime = 0.0f;
+    }
+
+    /* Interpolated Position
+    - Blends the positions before and after the last fixed step, so a renderer running faster than
+      the simulation shows smooth motion. See World::getAlpha.
+    - Parameters:
+        - alpha: 0 for the previous position, 1 for the current one.
+    - Returns: The blended position. */
+    utils::Vec3 RigidBodyComponent::interpolatedPosition(float alpha) const {
+        return utils::Vec3::lerp(previousPosition, position, alpha);
+    }
 }; // namespace omelette::ecs::components
@@ -5,24 +5,24 @@
 
 #include "../../utils/Vec3.hpp"
 #include "../Component.hpp"
-#include "ecs/Components/MeshComponent.hpp"
 
 namespace omelette::ecs::components {
     class RigidBodyComponent: public omelette::ecs::Component {
       public:
         utils::Vec3 position; // Position of the rigid body
+        utils::Vec3 previousPosition; // Position before the last fixed step
         utils::Vec3 velocity; // Velocity of the rigid body
         utils::Vec3 acceleration; // Acceleration of the rigid body
         float mass; // Mass of the rigid body
-        MeshComponent* meshComponent; // Reference to associated mesh component
+        bool sleeping = false; // Whether the body is at rest and skipped
+        float sleepTime = 0.0f; // Time the body has been nearly still
 
         // Parameterized constructor
         RigidBodyComponent(
             const utils::Vec3& position,
             const utils::Vec3& velocity,
             const utils::Vec3& acceleration,
-            float mass,
-            MeshComponent* meshComponent
+            float mass
         );
 
         // Update the rigid body's position and velocity
@@ -31,8 +31,15 @@ namespace omelette::ecs::components {
         // Clone function for copying components
         std::unique_ptr<Component> clone() const override;
 
-        // Apply a force to the rigid body
-        void applyForce(const utils::Vec3& force);
+        // Apply a force to the rigid body, waking it unless told not to.
+        // A force that does not wake a sleeping body is ignored.
+        void applyForce(const utils::Vec3& force, bool wake = true);
+
+        // Wake the rigid body and restart its sleep timer
+        void wake();
+
+        // Position blended between the last two fixed steps, for rendering
+        utils::Vec3 interpolatedPosition(float alpha) const;
     };
 }; // namespace omelette::ecs::components
 
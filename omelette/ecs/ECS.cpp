@@ -1,68 +1,221 @@
 #include "ECS.hpp"
 
+#include <stdexcept>
+
+#include "../utils/Profiler.hpp"
+#include "CommandBuffer.hpp"
+
 namespace omelette::ecs {
-    /* Add Entity
-    - Adds an entity to the ECS.
+    /* ECS Constructor
+    - Creates the archetype holding entities without components. */
+    ECS::ECS() :
+        commandBuffer(std::make_unique<omelette::ecs::CommandBuffer>()) {
+        emptyArchetype = addArchetype(std::make_unique<omelette::ecs::Archetype>(
+            std::vector<std::pair<
+                omelette::ecs::ComponentTypeId,
+                std::unique_ptr<omelette::ecs::ComponentColumn>>>()
+        ));
+    }
+
+    /* ECS Destructor
+    - Drops unapplied commands along with the entities. */
+    ECS::~ECS() = default;
+
+    /* Add Archetype
+    - Takes ownership of a new archetype, indexes it by signature and adds it
+      to every cached query it matches.
+    - Parameters:
+        - archetype: The archetype to add.
+    - Returns: Pointer to the stored archetype. */
+    omelette::ecs::Archetype*
+    ECS::addArchetype(std::unique_ptr<omelette::ecs::Archetype> archetype) {
+        auto* archetypePtr = archetype.get();
+        archetypes.push_back(std::move(archetype));
+        archetypeIndex.emplace(archetypePtr->getSignature(), archetypePtr);
+
+        std::lock_guard<std::mutex> lock(queryCacheMutex);
+        for (auto& [query, matches] : queryCache) {
+            if (archetypePtr->matches(query)) {
+                matches.push_back(archetypePtr);
+            }
+        }
+        return archetypePtr;
+    }
+
+    /* Create Entity
+    - Creates an entity without components. Freed slots are recycled with a
+      new generation.
+    - Returns: The new entity handle. */
+    omelette::ecs::Entity ECS::createEntity() {
+        auto entity = entityIndex.create();
+        if (entity.index() >= entityLocations.size()) {
+            entityLocations.resize(entity.index() + 1);
+        }
+        entityLocations[entity.index()] = {
+            emptyArchetype,
+            emptyArchetype->addEntity(entity)
+        };
+        OMELETTE_PROFILE_COUNTER("entities created", 1);
+        return entity;
+    }
+
+    /* Destroy Entity
+    - Destroys an entity and its components. The entity's archetype row is
+      swap-and-popped and its handle goes stale.
+    - Parameters:
+        - entity: The entity to destroy. Stale handles are ignored. */
+    void ECS::destroyEntity(omelette::ecs::Entity entity) {
+        if (!entityIndex.isAlive(entity)) {
+            return;
+        }
+
+        const auto& location = entityLocations[entity.index()];
+        auto moved = location.archetype->removeRow(location.row);
+        if (!moved.isNull()) {
+            entityLocations[moved.index()].row = location.row;
+        }
+        entityIndex.destroy(entity);
+        OMELETTE_PROFILE_COUNTER("entities destroyed", 1);
+    }
+
+    /* Destroy Entities
+    - Destroys a batch of entities, each by swap-and-popping its row.
     - Parameters:
-        - entity: The entity to add. */
-    void ECS::addEntity(std::unique_ptr<omelette::ecs::Entity> entity) {
-        entities.push_back(std::move(entity));
+        - entities: The entities to destroy. Stale handles are ignored. */
+    void
+    ECS::destroyEntities(const std::vector<omelette::ecs::Entity>& entities) {
+        for (auto entity : entities) {
+            destroyEntity(entity);
+        }
     }
 
-    /* Add Component To Entity
-    - Adds a component to an entity.
+    /* Is Alive
+    - Checks whether an entity handle refers to a live entity.
     - Parameters:
-        - entity: The entity to add the component to.
-        - component: The component to add. */
-    void ECS::addComponentToEntity(
-        omelette::ecs::Entity& entity,
-        std::unique_ptr<omelette::ecs::Component> component
-    ) {
-        entityComponents[&entity].push_back(std::move(component));
+        - entity: The handle to check.
+    - Returns: True if the entity has not been destroyed. */
+    bool ECS::isAlive(omelette::ecs::Entity entity) const {
+        return entityIndex.isAlive(entity);
+    }
+
+    /* Locate
+    - Returns the archetype row of a live entity.
+    - Parameters:
+        - entity: The entity to locate.
+    - Returns: The entity's location. Throws std::out_of_range if stale. */
+    ECS::EntityLocation& ECS::locate(omelette::ecs::Entity entity) {
+        if (!entityIndex.isAlive(entity)) {
+            throw std::out_of_range("ECS: stale or invalid entity handle");
+        }
+        return entityLocations[entity.index()];
+    }
+
+    /* Get Signature
+    - Returns the component types of an entity as a bit set, e.g. to check
+      several types at once with Signature::contains.
+    - Parameters:
+        - entity: The entity to look up.
+    - Returns: The entity's signature, or an empty one if it is stale. */
+    omelette::ecs::Signature
+    ECS::getSignature(omelette::ecs::Entity entity) const {
+        if (!entityIndex.isAlive(entity)) {
+            return omelette::ecs::Signature();
+        }
+        return entityLocations[entity.index()].archetype->getSignature();
     }
 
     /* Get Entities
-    - Returns the list of entities in the ECS.
+    - Returns the list of live entities in the ECS.
     - Returns: The list of entities. */
-    const std::vector<std::unique_ptr<omelette::ecs::Entity>>&
-    ECS::getEntities() const {
-        return entities;
-    }
-
-    /* Get Components
-    - Returns the list of components in the ECS.
-    - Returns: The list of components. */
-    const std::vector<std::unique_ptr<omelette::ecs::Component>>&
-    ECS::getComponents() const {
-        static std::vector<std::unique_ptr<omelette::ecs::Component>>
-            allComponents;
-        allComponents.clear();
-        for (const auto& pair : entityComponents) {
-            for (const auto& component : pair.second) {
-                allComponents.push_back(component->clone());
+    const std::vector<omelette::ecs::Entity>& ECS::getEntities() const {
+        return entityIndex.getEntities();
+    }
+
+    /* Get Entity Capacity
+    - Returns: The number of entity slots ever allocated. Every entity index
+      is below it, so it sizes arrays indexed by entity index. */
+    size_t ECS::getEntityCapacity() const {
+        return entityIndex.capacity();
+    }
+
+    /* Get Archetypes
+    - Returns the list of archetypes in the ECS.
+    - Returns: The list of archetypes. */
+    const std::vector<std::unique_ptr<omelette::ecs::Archetype>>&
+    ECS::getArchetypes() const {
+        return archetypes;
+    }
+
+    /* Get Component Count
+    - Returns the number of live components in the ECS.
+    - Returns: The component count. */
+    size_t ECS::getComponentCount() const {
+        size_t count = 0;
+        for (const auto& archetype : archetypes) {
+            count += archetype->size() * archetype->getColumns().size();
+        }
+        return count;
+    }
+
+    /* Get Component Stats
+    - Returns: The memory use of every component type stored so far, by
+      type. Types whose components were all removed stay listed with a
+      live count of zero. */
+    const ECS::ComponentStatsByType& ECS::getComponentStats() const {
+        return componentStats;
+    }
+
+    /* Shrink To Fit
+    - Releases component storage beyond what is in use. Entities that gain
+      components one at a time pass through intermediate archetypes whose
+      columns keep their peak capacity; call this after a large spawn or
+      despawn to give that memory back. Invalidates component references. */
+    void ECS::shrinkToFit() {
+        for (auto& archetype : archetypes) {
+            for (const auto& column : archetype->getColumns()) {
+                column->shrinkToFit();
             }
         }
-        return allComponents;
-    }
-
-    /* Get Entities by Component
-    - Returns a list of entities that have a specific component type.
-    - Template Parameters:
-        - T: The component type to search for.
-    - Returns: The list of entities with the specified component type. */
-    template<typename T>
-    std::vector<omelette::ecs::Entity*> ECS::getEntitiesByComponent() const {
-        std::vector<omelette::ecs::Entity*> entitiesWithComponent;
-        for (const auto& pair : entityComponents) {
-            for (const auto& component : pair.second) {
-                if (std::is_same<T, std::decay_t<decltype(*component)>>::
-                        value) {
-                    entitiesWithComponent.push_back(pair.first);
-                    break;
-                }
+    }
+
+    /* Create Snapshot
+    - Deep copies every live component. Prefer forEachComponent or view()
+      unless an independent copy is really needed.
+    - Returns: The copies, owned by the caller. */
+    std::vector<std::unique_ptr<omelette::ecs::Component>>
+    ECS::createSnapshot() const {
+        OMELETTE_PROFILE_ZONE("ECS::createSnapshot");
+        std::vector<std::unique_ptr<omelette::ecs::Component>> snapshot;
+        snapshot.reserve(getComponentCount());
+        forEachComponent([&snapshot](const omelette::ecs::Component& component) {
+            snapshot.push_back(component.clone());
+        });
+        return snapshot;
+    }
+
+    /* Get Matching Archetypes
+    - Returns the archetypes storing every component type of a query. The
+      result is cached and kept up to date, so repeated queries only pay for
+      a signature lookup.
+    - Parameters:
+        - query: The component types to look for.
+    - Returns: The matching archetypes. */
+    const std::vector<omelette::ecs::Archetype*>&
+    ECS::getMatchingArchetypes(const omelette::ecs::Signature& query) const {
+        std::lock_guard<std::mutex> lock(queryCacheMutex);
+        auto it = queryCache.find(query);
+        if (it != queryCache.end()) {
+            return it->second;
+        }
+
+        OMELETTE_PROFILE_ZONE("ECS::getMatchingArchetypes");
+        std::vector<omelette::ecs::Archetype*> matches;
+        for (const auto& archetype : archetypes) {
+            if (archetype->matches(query)) {
+                matches.push_back(archetype.get());
             }
         }
-        return entitiesWithComponent;
+        return queryCache.emplace(query, std::move(matches)).first->second;
     }
 
     /* Get Components for Entity
@@ -70,14 +223,49 @@ namespace omelette::ecs {
     - Parameters:
         - entity: The entity to get components for.
     - Returns: The list of components for the entity. */
-    const std::vector<std::unique_ptr<omelette::ecs::Component>>&
-    ECS::getComponentsForEntity(const omelette::ecs::Entity& entity) const {
-        static std::vector<std::unique_ptr<omelette::ecs::Component>> empty;
-        auto it =
-            entityComponents.find(const_cast<omelette::ecs::Entity*>(&entity));
-        if (it != entityComponents.end()) {
-            return it->second;
+    std::vector<omelette::ecs::Component*>
+    ECS::getComponentsForEntity(omelette::ecs::Entity entity) const {
+        std::vector<omelette::ecs::Component*> components;
+        if (entityIndex.isAlive(entity)) {
+            const auto& [archetype, row] = entityLocations[entity.index()];
+            for (const auto& column : archetype->getColumns()) {
+                components.push_back(&column->get(row));
+            }
         }
-        return empty;
+        return components;
+    }
+
+    /* Update
+    - Calls Component::update on every component, one archetype column at a
+      time. Cross-component behaviour lives in systems run by a Scheduler.
+    - Parameters:
+        - deltaTime: Time elapsed since last update. */
+    void ECS::update(float deltaTime) {
+        OMELETTE_PROFILE_ZONE("ECS::update");
+        for (auto& archetype : archetypes) {
+            archetype->update(deltaTime);
+        }
+    }
+
+    /* Get Frame Arena
+    - Returns: The arena for scratch data of the current step. Scheduler::run
+      resets it once every system has finished, so nothing allocated from
+      it may be kept past the step. */
+    omelette::utils::FrameArena& ECS::getFrameArena() {
+        return frameArena;
+    }
+
+    /* Get Command Buffer
+    - Returns: The buffer whose commands applyCommands() applies. Systems
+      may record into it from any thread while the scheduler runs. */
+    omelette::ecs::CommandBuffer& ECS::getCommandBuffer() {
+        return *commandBuffer;
+    }
+
+    /* Apply Commands
+    - Applies the command buffer's structural changes in recording order
+      and clears it. Must not run while systems are iterating. */
+    void ECS::applyCommands() {
+        commandBuffer->apply(*this);
     }
 }; // namespace omelette::ecs
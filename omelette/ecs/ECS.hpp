@@ -1,51 +1,708 @@
 #ifndef OMELETTE_ECS_ECS_HPP
 #define OMELETTE_ECS_ECS_HPP
 
+#include <algorithm>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "../utils/FrameArena.hpp"
+#include "../utils/Profiler.hpp"
+#include "Archetype.hpp"
 #include "Component.hpp"
+#include "ComponentStats.hpp"
 #include "Entity.hpp"
+#include "EntityIndex.hpp"
+#include "View.hpp"
 
 namespace omelette::ecs {
+    class CommandBuffer;
+
     class ECS {
+      public:
+        // Memory statistics of each component type
+        using ComponentStatsByType =
+            std::unordered_map<
+                omelette::ecs::ComponentTypeId,
+                omelette::ecs::ComponentStats>;
+
       private:
-        // List of entities
-        std::vector<std::unique_ptr<omelette::ecs::Entity>> entities;
+        // Location of an entity's row in archetype storage
+        struct EntityLocation {
+            omelette::ecs::Archetype* archetype = nullptr;
+            size_t row = 0;
+        };
+
+        // Live entity handles
+        omelette::ecs::EntityIndex entityIndex;
+
+        // Archetype row of each entity, indexed by entity slot index
+        std::vector<EntityLocation> entityLocations;
+
+        // Memory use of each component type stored so far. Declared before
+        // the archetypes, whose columns report to it until destroyed.
+        ComponentStatsByType componentStats;
+
+        // Archetypes, one per distinct component signature
+        std::vector<std::unique_ptr<omelette::ecs::Archetype>> archetypes;
 
-        // Map of entities to their components
-        std::unordered_map<
-            omelette::ecs::Entity*,
-            std::vector<std::unique_ptr<omelette::ecs::Component>>>
-            entityComponents;
+        // Map of signatures to their archetype
+        std::unordered_map<omelette::ecs::Signature, omelette::ecs::Archetype*>
+            archetypeIndex;
+
+        // Archetype of entities without components
+        omelette::ecs::Archetype* emptyArchetype;
+
+        // Scratch memory for the current step, reset by Scheduler::run
+        omelette::utils::FrameArena frameArena;
+
+        // Structural changes deferred to the end of the step
+        std::unique_ptr<omelette::ecs::CommandBuffer> commandBuffer;
+
+        // Archetypes matching each query signature seen so far, kept up to
+        // date as new archetypes are created. Guarded so systems running in
+        // parallel can issue new queries.
+        mutable std::mutex queryCacheMutex;
+        mutable std::unordered_map<
+            omelette::ecs::Signature,
+            std::vector<omelette::ecs::Archetype*>>
+            queryCache;
+
+        // Take ownership of a new archetype and register it with the indexes
+        omelette::ecs::Archetype*
+        addArchetype(std::unique_ptr<omelette::ecs::Archetype> archetype);
+
+        // Get or create the memory statistics of a component type
+        template<typename T>
+        omelette::ecs::ComponentStats& getOrCreateStats();
+
+        // Get or create the archetype storing exactly Ts
+        template<typename... Ts>
+        omelette::ecs::Archetype* getOrCreateArchetype();
+
+        // Get or create the archetype storing a signature plus T
+        template<typename T>
+        omelette::ecs::Archetype*
+        getArchetypeWith(omelette::ecs::Archetype& source);
+
+        // Get or create the archetype storing a signature minus T
+        template<typename T>
+        omelette::ecs::Archetype*
+        getArchetypeWithout(omelette::ecs::Archetype& source);
+
+        // Get the location of a live entity; throws if the handle is stale
+        EntityLocation& locate(omelette::ecs::Entity entity);
 
       public:
-        // Add an entity to the ECS
-        void addEntity(std::unique_ptr<omelette::ecs::Entity> entity);
+        ECS();
+        ~ECS();
+
+        ECS(const ECS&) = delete;
+        ECS& operator=(const ECS&) = delete;
+
+        // Create an entity without components
+        omelette::ecs::Entity createEntity();
+
+        // Create count entities, each with a copy of the given components,
+        // directly in their final archetype
+        template<typename... Ts>
+        std::vector<omelette::ecs::Entity>
+        createEntities(size_t count, const Ts&... components);
+
+        // Reserve room for count more entities storing exactly Ts
+        template<typename... Ts>
+        void reserveEntities(size_t count);
+
+        // Destroy an entity and its components; stale handles are ignored
+        void destroyEntity(omelette::ecs::Entity entity);
+
+        // Destroy several entities; stale handles are ignored
+        void
+        destroyEntities(const std::vector<omelette::ecs::Entity>& entities);
+
+        // Check whether an entity handle refers to a live entity
+        bool isAlive(omelette::ecs::Entity entity) const;
 
-        // Add a component to an entity.
-        void addComponentToEntity(
-            omelette::ecs::Entity& entity,
-            std::unique_ptr<omelette::ecs::Component> component
+        // Add a component to an entity, replacing any of the same type.
+        // Components are stored by value; the returned reference is valid
+        // until the next structural change.
+        template<typename T>
+        T& addComponentToEntity(omelette::ecs::Entity entity, T component);
+
+        template<typename T>
+        T& addComponentToEntity(
+            omelette::ecs::Entity entity,
+            std::unique_ptr<T> component
         );
 
-        // Get the list of entities
-        const std::vector<std::unique_ptr<omelette::ecs::Entity>>&
-        getEntities() const;
+        // Remove an entity's component of type T. Returns false if the
+        // entity is stale or has no T.
+        template<typename T>
+        bool removeComponentFromEntity(omelette::ecs::Entity entity);
+
+        // Get an entity's component of type T, or nullptr
+        template<typename T>
+        T* getComponent(omelette::ecs::Entity entity);
+
+        template<typename T>
+        const T* getComponent(omelette::ecs::Entity entity) const;
+
+        // Check whether an entity has a component of type T; a bit test
+        template<typename T>
+        bool hasComponent(omelette::ecs::Entity entity) const;
+
+        // Get the component types of an entity; empty if it is stale
+        omelette::ecs::Signature
+        getSignature(omelette::ecs::Entity entity) const;
+
+        // Get the list of live entities
+        const std::vector<omelette::ecs::Entity>& getEntities() const;
+
+        // Number of entity slots; every entity index is below it
+        size_t getEntityCapacity() const;
 
-        // Get the list of components
-        const std::vector<std::unique_ptr<omelette::ecs::Component>>&
-        getComponents() const;
+        // Get the list of archetypes
+        const std::vector<std::unique_ptr<omelette::ecs::Archetype>>&
+        getArchetypes() const;
+
+        // Visit every live component in place, without copying or allocating
+        template<typename Function>
+        void forEachComponent(Function&& function);
+
+        template<typename Function>
+        void forEachComponent(Function&& function) const;
+
+        // Visit every live component of type T in place
+        template<typename T, typename Function>
+        void forEachComponent(Function&& function);
+
+        // Visit the live components of one entity in place
+        template<typename Function>
+        void forEachComponent(omelette::ecs::Entity entity, Function&& function);
+
+        // Number of live components in the ECS
+        size_t getComponentCount() const;
+
+        // Memory use of a component type, or nullptr if never stored
+        template<typename T>
+        const omelette::ecs::ComponentStats* getComponentStats() const;
+
+        // Memory use of every component type stored so far
+        const ComponentStatsByType& getComponentStats() const;
+
+        // Release component storage beyond what is in use
+        void shrinkToFit();
+
+        // Deep copy of every component, owned by the caller
+        std::vector<std::unique_ptr<omelette::ecs::Component>>
+        createSnapshot() const;
+
+        // Copy of every component of type T, owned by the caller
+        template<typename T>
+        std::vector<T> createSnapshot() const;
 
         // Get components for a specific entity
-        const std::vector<std::unique_ptr<omelette::ecs::Component>>&
-        getComponentsForEntity(const omelette::ecs::Entity& entity) const;
+        std::vector<omelette::ecs::Component*>
+        getComponentsForEntity(omelette::ecs::Entity entity) const;
 
         // Get entities with a specific component type
         template<typename T>
-        std::vector<omelette::ecs::Entity*> getEntitiesByComponent() const;
+        std::vector<omelette::ecs::Entity> getEntitiesByComponent() const;
+
+        // Same, allocated from a memory resource such as getFrameArena()
+        template<typename T>
+        std::pmr::vector<omelette::ecs::Entity>
+        getEntitiesByComponent(std::pmr::memory_resource* resource) const;
+
+        // Get the archetypes storing every component type of a query
+        const std::vector<omelette::ecs::Archetype*>&
+        getMatchingArchetypes(const omelette::ecs::Signature& query) const;
+
+        // Get a view over every entity having all component types Ts
+        template<typename... Ts>
+        omelette::ecs::View<Ts...> view();
+
+        // Call Component::update on every component, one column at a time
+        void update(float deltaTime);
+
+        // Scratch memory for data that lives until the end of the step
+        omelette::utils::FrameArena& getFrameArena();
+
+        // Buffer for structural changes made while iterating or from
+        // parallel systems, applied by applyCommands()
+        omelette::ecs::CommandBuffer& getCommandBuffer();
+
+        // Apply and clear the command buffer; Scheduler::run calls this
+        // once every system has finished
+        void applyCommands();
     };
+
+    /* Get Or Create Stats
+    - Returns the statistics every column of a component type reports to,
+      creating them the first time the type is stored.
+    - Template Parameters:
+        - T: The component type.
+    - Returns: The type's statistics. */
+    template<typename T>
+    omelette::ecs::ComponentStats& ECS::getOrCreateStats() {
+        const auto type = omelette::ecs::getComponentTypeId<T>();
+        auto [it, inserted] = componentStats.try_emplace(type);
+        if (inserted) {
+            it->second.type = type;
+            it->second.componentSize = sizeof(T);
+        }
+        return it->second;
+    }
+
+    /* Get Or Create Archetype
+    - Finds the archetype storing exactly the given component types,
+      creating it if needed.
+    - Template Parameters:
+        - Ts: The component types, each at most once.
+    - Returns: The archetype. */
+    template<typename... Ts>
+    omelette::ecs::Archetype* ECS::getOrCreateArchetype() {
+        static const auto signature = omelette::ecs::makeSignature<Ts...>();
+        if (signature.count() != sizeof...(Ts)) {
+            throw std::invalid_argument("ECS: duplicate component type");
+        }
+
+        auto it = archetypeIndex.find(signature);
+        if (it != archetypeIndex.end()) {
+            return it->second;
+        }
+
+        std::vector<std::pair<
+            omelette::ecs::ComponentTypeId,
+            std::unique_ptr<omelette::ecs::ComponentColumn>>>
+            columnTypes;
+        (columnTypes.emplace_back(
+             omelette::ecs::getComponentTypeId<Ts>(),
+             std::make_unique<omelette::ecs::TypedColumn<Ts>>(
+                 &getOrCreateStats<Ts>()
+             )
+         ),
+         ...);
+        return addArchetype(
+            std::make_unique<omelette::ecs::Archetype>(std::move(columnTypes))
+        );
+    }
+
+    /* Get Archetype With
+    - Finds the archetype storing the source's components plus T, creating
+      it (and caching the transition) if needed.
+    - Template Parameters:
+        - T: The component type being added.
+    - Parameters:
+        - source: The archetype the entity currently lives in.
+    - Returns: The destination archetype. */
+    template<typename T>
+    omelette::ecs::Archetype*
+    ECS::getArchetypeWith(omelette::ecs::Archetype& source) {
+        const auto type = omelette::ecs::getComponentTypeId<T>();
+        if (auto* cached = source.getAddEdge(type)) {
+            return cached;
+        }
+
+        omelette::ecs::Signature signature = source.getSignature();
+        signature.add(type);
+
+        omelette::ecs::Archetype* destination;
+        auto it = archetypeIndex.find(signature);
+        if (it != archetypeIndex.end()) {
+            destination = it->second;
+        } else {
+            std::vector<std::pair<
+                omelette::ecs::ComponentTypeId,
+                std::unique_ptr<omelette::ecs::ComponentColumn>>>
+                columnTypes;
+            const auto& sourceColumns = source.getColumns();
+            for (size_t i = 0; i < sourceColumns.size(); i++) {
+                columnTypes.emplace_back(
+                    source.getTypes()[i],
+                    sourceColumns[i]->createEmpty()
+                );
+            }
+            columnTypes.emplace_back(
+                type,
+                std::make_unique<omelette::ecs::TypedColumn<T>>(
+                    &getOrCreateStats<T>()
+                )
+            );
+
+            destination = addArchetype(
+                std::make_unique<omelette::ecs::Archetype>(
+                    std::move(columnTypes)
+                )
+            );
+        }
+
+        source.setAddEdge(type, destination);
+        return destination;
+    }
+
+    /* Get Archetype Without
+    - Finds the archetype storing the source's components minus T, creating
+      it (and caching the transition) if needed.
+    - Template Parameters:
+        - T: The component type being removed; the source must store it.
+    - Parameters:
+        - source: The archetype the entity currently lives in.
+    - Returns: The destination archetype. */
+    template<typename T>
+    omelette::ecs::Archetype*
+    ECS::getArchetypeWithout(omelette::ecs::Archetype& source) {
+        const auto type = omelette::ecs::getComponentTypeId<T>();
+        if (auto* cached = source.getRemoveEdge(type)) {
+            return cached;
+        }
+
+        omelette::ecs::Signature signature = source.getSignature();
+        signature.remove(type);
+
+        omelette::ecs::Archetype* destination;
+        auto it = archetypeIndex.find(signature);
+        if (it != archetypeIndex.end()) {
+            destination = it->second;
+        } else {
+            std::vector<std::pair<
+                omelette::ecs::ComponentTypeId,
+                std::unique_ptr<omelette::ecs::ComponentColumn>>>
+                columnTypes;
+            const auto& sourceColumns = source.getColumns();
+            for (size_t i = 0; i < sourceColumns.size(); i++) {
+                if (source.getTypes()[i] != type) {
+                    columnTypes.emplace_back(
+                        source.getTypes()[i],
+                        sourceColumns[i]->createEmpty()
+                    );
+                }
+            }
+
+            destination = addArchetype(
+                std::make_unique<omelette::ecs::Archetype>(
+                    std::move(columnTypes)
+                )
+            );
+        }
+
+        source.setRemoveEdge(type, destination);
+        return destination;
+    }
+
+    /* Create Entities
+    - Creates a batch of entities with the same components. The entities
+      go straight into the archetype storing Ts, whose storage is reserved
+      up front, instead of moving through one archetype per component.
+    - Template Parameters:
+        - Ts: The component types, each at most once.
+    - Parameters:
+        - count: The number of entities to create.
+        - components: The components copied into every entity.
+    - Returns: The new entity handles, in creation order. */
+    template<typename... Ts>
+    std::vector<omelette::ecs::Entity>
+    ECS::createEntities(size_t count, const Ts&... components) {
+        omelette::ecs::Archetype* archetype = getOrCreateArchetype<Ts...>();
+        reserveEntities<Ts...>(count);
+
+        std::vector<omelette::ecs::Entity> created;
+        created.reserve(count);
+        auto fill = [&](omelette::ecs::TypedColumn<Ts>*... columns) {
+            for (size_t i = 0; i < count; i++) {
+                const auto entity = entityIndex.create();
+                if (entity.index() >= entityLocations.size()) {
+                    entityLocations.resize(entity.index() + 1);
+                }
+                entityLocations[entity.index()] = {
+                    archetype,
+                    archetype->addEntity(entity)
+                };
+                (columns->push(components), ...);
+                created.push_back(entity);
+            }
+        };
+        fill(archetype->getColumn<Ts>()...);
+
+        OMELETTE_PROFILE_COUNTER("entities created", count);
+        return created;
+    }
+
+    /* Reserve Entities
+    - Reserves storage so that count more entities storing exactly Ts can
+      be created without reallocating.
+    - Template Parameters:
+        - Ts: The component types, each at most once.
+    - Parameters:
+        - count: The number of entities to make room for. */
+    template<typename... Ts>
+    void ECS::reserveEntities(size_t count) {
+        omelette::ecs::Archetype* archetype = getOrCreateArchetype<Ts...>();
+        archetype->reserve(archetype->size() + count);
+        entityIndex.reserve(entityIndex.size() + count);
+        entityLocations.reserve(
+            std::max(entityIndex.capacity(), entityIndex.size() + count)
+        );
+    }
+
+    /* Add Component To Entity
+    - Adds a component to an entity by moving the entity's row into the
+      archetype that also stores T. Replaces an existing T in place.
+    - Template Parameters:
+        - T: The component type to add.
+    - Parameters:
+        - entity: The entity to add the component to.
+        - component: The component to add.
+    - Returns: Reference to the stored component. */
+    template<typename T>
+    T& ECS::addComponentToEntity(omelette::ecs::Entity entity, T component) {
+        auto& location = locate(entity);
+
+        if (auto* existing = location.archetype->getComponents<T>()) {
+            auto& slot = (*existing)[location.row];
+            slot = std::move(component);
+            return slot;
+        }
+
+        omelette::ecs::Archetype* destination =
+            getArchetypeWith<T>(*location.archetype);
+        auto moved = location.archetype->moveRowTo(location.row, *destination);
+        if (!moved.isNull()) {
+            entityLocations[moved.index()].row = location.row;
+        }
+
+        auto& stored =
+            destination->getColumn<T>()->push(std::move(component));
+
+        location.archetype = destination;
+        location.row = destination->size() - 1;
+        return stored;
+    }
+
+    template<typename T>
+    T& ECS::addComponentToEntity(
+        omelette::ecs::Entity entity,
+        std::unique_ptr<T> component
+    ) {
+        return addComponentToEntity<T>(entity, std::move(*component));
+    }
+
+    /* Remove Component From Entity
+    - Removes a component by moving the entity's row into the archetype
+      without T; the component is destroyed.
+    - Template Parameters:
+        - T: The component type to remove.
+    - Parameters:
+        - entity: The entity to remove the component from.
+    - Returns: True if a component was removed. */
+    template<typename T>
+    bool ECS::removeComponentFromEntity(omelette::ecs::Entity entity) {
+        if (!entityIndex.isAlive(entity)) {
+            return false;
+        }
+        auto& location = entityLocations[entity.index()];
+        if (!location.archetype->hasComponent<T>()) {
+            return false;
+        }
+
+        omelette::ecs::Archetype* destination =
+            getArchetypeWithout<T>(*location.archetype);
+        auto moved = location.archetype->moveRowTo(location.row, *destination);
+        if (!moved.isNull()) {
+            entityLocations[moved.index()].row = location.row;
+        }
+
+        location.archetype = destination;
+        location.row = destination->size() - 1;
+        return true;
+    }
+
+    /* Get Component
+    - Returns an entity's component of a given type.
+    - Template Parameters:
+        - T: The component type to get.
+    - Parameters:
+        - entity: The entity to get the component for.
+    - Returns: Pointer to the component, or nullptr if absent. */
+    template<typename T>
+    T* ECS::getComponent(omelette::ecs::Entity entity) {
+        if (!entityIndex.isAlive(entity)) {
+            return nullptr;
+        }
+        const auto& location = entityLocations[entity.index()];
+        auto* column = location.archetype->getComponents<T>();
+        return column ? &(*column)[location.row] : nullptr;
+    }
+
+    template<typename T>
+    const T* ECS::getComponent(omelette::ecs::Entity entity) const {
+        return const_cast<ECS*>(this)->getComponent<T>(entity);
+    }
+
+    /* Has Component
+    - Checks whether an entity has a component, by testing its archetype's
+      signature bit for T.
+    - Template Parameters:
+        - T: The component type to check for.
+    - Parameters:
+        - entity: The entity to check.
+    - Returns: True if the entity is alive and has a T. */
+    template<typename T>
+    bool ECS::hasComponent(omelette::ecs::Entity entity) const {
+        return entityIndex.isAlive(entity)
+            && entityLocations[entity.index()].archetype->hasComponent<T>();
+    }
+
+    /* Get Entities by Component
+    - Returns a list of entities that have a specific component type.
+    - Template Parameters:
+        - T: The component type to search for.
+    - Returns: The list of entities with the specified component type. */
+    template<typename T>
+    std::vector<omelette::ecs::Entity> ECS::getEntitiesByComponent() const {
+        static const auto query = omelette::ecs::makeSignature<T>();
+
+        std::vector<omelette::ecs::Entity> entitiesWithComponent;
+        for (const auto* archetype : getMatchingArchetypes(query)) {
+            const auto& rows = archetype->getEntities();
+            entitiesWithComponent
+                .insert(entitiesWithComponent.end(), rows.begin(), rows.end());
+        }
+        return entitiesWithComponent;
+    }
+
+    /* Get Entities by Component
+    - Returns a list of entities that have a specific component type, in
+      memory from the given resource. With the frame arena, the list costs
+      no heap allocation and is valid until the end of the step.
+    - Template Parameters:
+        - T: The component type to search for.
+    - Parameters:
+        - resource: Where the list is allocated.
+    - Returns: The list of entities with the specified component type. */
+    template<typename T>
+    std::pmr::vector<omelette::ecs::Entity>
+    ECS::getEntitiesByComponent(std::pmr::memory_resource* resource) const {
+        static const auto query = omelette::ecs::makeSignature<T>();
+        const auto& archetypes = getMatchingArchetypes(query);
+
+        size_t count = 0;
+        for (const auto* archetype : archetypes) {
+            count += archetype->size();
+        }
+
+        std::pmr::vector<omelette::ecs::Entity> entitiesWithComponent(resource);
+        entitiesWithComponent.reserve(count);
+        for (const auto* archetype : archetypes) {
+            const auto& rows = archetype->getEntities();
+            entitiesWithComponent
+                .insert(entitiesWithComponent.end(), rows.begin(), rows.end());
+        }
+        return entitiesWithComponent;
+    }
+
+    /* View
+    - Returns a view over every entity that has all of the given component
+      types. Use const types for read-only access.
+    - Template Parameters:
+        - Ts: The component types to query.
+    - Returns: An iterable view yielding (entity, components...) tuples. */
+    template<typename... Ts>
+    omelette::ecs::View<Ts...> ECS::view() {
+        static const auto query = omelette::ecs::makeSignature<Ts...>();
+        return omelette::ecs::View<Ts...>(getMatchingArchetypes(query));
+    }
+
+    /* For Each Component
+    - Calls a function on every live component, in archetype column order.
+      Components are visited in place: nothing is cloned or allocated.
+    - Parameters:
+        - function: Called as function(Component&). */
+    template<typename Function>
+    void ECS::forEachComponent(Function&& function) {
+        for (auto& archetype : archetypes) {
+            for (const auto& column : archetype->getColumns()) {
+                const size_t count = column->size();
+                for (size_t row = 0; row < count; row++) {
+                    function(column->get(row));
+                }
+            }
+        }
+    }
+
+    template<typename Function>
+    void ECS::forEachComponent(Function&& function) const {
+        for (const auto& archetype : archetypes) {
+            for (const auto& column : archetype->getColumns()) {
+                const auto& constColumn = *column;
+                const size_t count = constColumn.size();
+                for (size_t row = 0; row < count; row++) {
+                    function(constColumn.get(row));
+                }
+            }
+        }
+    }
+
+    /* For Each Component
+    - Calls a function on every live component of one type, in place.
+    - Template Parameters:
+        - T: The component type to visit.
+    - Parameters:
+        - function: Called as function(T&). */
+    template<typename T, typename Function>
+    void ECS::forEachComponent(Function&& function) {
+        view<T>().each(std::forward<Function>(function));
+    }
+
+    /* For Each Component
+    - Calls a function on every live component of one entity, in place.
+    - Parameters:
+        - entity: The entity to visit. Stale handles visit nothing.
+        - function: Called as function(Component&). */
+    template<typename Function>
+    void ECS::forEachComponent(omelette::ecs::Entity entity, Function&& function) {
+        if (!entityIndex.isAlive(entity)) {
+            return;
+        }
+
+        const auto& [archetype, row] = entityLocations[entity.index()];
+        for (const auto& column : archetype->getColumns()) {
+            function(column->get(row));
+        }
+    }
+
+    /* Create Snapshot
+    - Copies every live component of one type.
+    - Template Parameters:
+        - T: The component type to copy.
+    - Returns: The copies, owned by the caller. */
+    template<typename T>
+    std::vector<T> ECS::createSnapshot() const {
+        static const auto query = omelette::ecs::makeSignature<T>();
+
+        std::vector<T> snapshot;
+        for (const omelette::ecs::Archetype* archetype :
+             getMatchingArchetypes(query)) {
+            const auto& components = *archetype->getComponents<T>();
+            snapshot.insert(snapshot.end(), components.begin(), components.end());
+        }
+        return snapshot;
+    }
+
+    /* Get Component Stats
+    - Returns the memory use of one component type across all archetypes.
+    - Template Parameters:
+        - T: The component type.
+    - Returns: The type's statistics, or nullptr if it was never stored. */
+    template<typename T>
+    const omelette::ecs::ComponentStats* ECS::getComponentStats() const {
+        auto it = componentStats.find(omelette::ecs::getComponentTypeId<T>());
+        return it != componentStats.end() ? &it->second : nullptr;
+    }
 }; // namespace omelette::ecs
 
 #endif // OMELETTE_ECS_ECS_HPP
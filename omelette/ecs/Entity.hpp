@@ -1,8 +1,73 @@
 #ifndef OMELETTE_ECS_ENTITY_HPP
 #define OMELETTE_ECS_ENTITY_HPP
 
+#include <cstdint>
+#include <functional>
+
 namespace omelette::ecs {
-    class Entity {};
+    // Compact 32-bit entity handle: a 20-bit slot index in the low bits and
+    // a 12-bit generation in the high bits, so up to about a million live
+    // entities. The generation is bumped every time the slot is recycled,
+    // so a handle to a destroyed entity is detected as stale. It wraps
+    // modulo 2^GENERATION_BITS rather than retiring the slot: a stale
+    // handle is only mistaken for a live one if it is kept across exactly
+    // a multiple of 4096 recycles of its slot.
+    class Entity {
+      public:
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t GENERATION_BITS = 32 - INDEX_BITS;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1;
+
+        // Largest usable index; the all-ones index is reserved for null
+        static constexpr uint32_t MAX_INDEX = INDEX_MASK - 1;
+
+        uint32_t id; // Packed index and generation
+
+        // Default constructor (null handle)
+        constexpr Entity() : id(UINT32_MAX) {}
+
+        // Parameterized constructor
+        constexpr Entity(uint32_t index, uint32_t generation) :
+            id((index & INDEX_MASK) | (generation << INDEX_BITS)) {}
+
+        // Slot index of the entity
+        constexpr uint32_t index() const {
+            return id & INDEX_MASK;
+        }
+
+        // Generation of the slot when the handle was created
+        constexpr uint32_t generation() const {
+            return id >> INDEX_BITS;
+        }
+
+        // Whether this is the null handle
+        constexpr bool isNull() const {
+            return id == UINT32_MAX;
+        }
+
+        constexpr bool operator==(const Entity& other) const {
+            return id == other.id;
+        }
+
+        constexpr bool operator!=(const Entity& other) const {
+            return id != other.id;
+        }
+
+        constexpr bool operator<(const Entity& other) const {
+            return id < other.id;
+        }
+    };
 }; // namespace omelette::ecs
 
+namespace std {
+    // Hash entities by their packed id
+    template<>
+    struct hash<omelette::ecs::Entity> {
+        size_t operator()(const omelette::ecs::Entity& entity) const noexcept {
+            return hash<uint32_t>()(entity.id);
+        }
+    };
+}; // namespace std
+
 #endif // OMELETTE_ECS_ENTITY_HPP
@@ -0,0 +1,82 @@
+#include "EntityIndex.hpp"
+
+#include <stdexcept>
+
+namespace omelette::ecs {
+    /* Create
+    - Creates a new entity handle, reusing a freed slot if one is available.
+    - Returns: The new entity handle. */
+    omelette::ecs::Entity EntityIndex::create() {
+        uint32_t index;
+        if (!freeIndices.empty()) {
+            index = freeIndices.back();
+            freeIndices.pop_back();
+        } else {
+            if (generations.size() > omelette::ecs::Entity::MAX_INDEX) {
+                throw std::length_error("EntityIndex: out of entity slots");
+            }
+            index = static_cast<uint32_t>(generations.size());
+            generations.push_back(0);
+            sparse.push_back(0);
+        }
+
+        omelette::ecs::Entity entity(index, generations[index]);
+        sparse[index] = static_cast<uint32_t>(dense.size());
+        dense.push_back(entity);
+        return entity;
+    }
+
+    /* Destroy
+    - Removes an entity handle by swapping the last live entity into its
+      dense slot, and bumps the slot's generation so old handles go stale.
+      The generation wraps modulo 2^GENERATION_BITS, so every slot can be
+      recycled forever.
+    - Parameters:
+        - entity: The handle to destroy.
+    - Returns: False if the handle was already stale. */
+    bool EntityIndex::destroy(omelette::ecs::Entity entity) {
+        if (!isAlive(entity)) {
+            return false;
+        }
+
+        const uint32_t index = entity.index();
+        const uint32_t position = sparse[index];
+        const omelette::ecs::Entity last = dense.back();
+        dense[position] = last;
+        sparse[last.index()] = position;
+        dense.pop_back();
+
+        generations[index] =
+            (generations[index] + 1) & omelette::ecs::Entity::GENERATION_MASK;
+        freeIndices.push_back(index);
+        return true;
+    }
+
+    /* Size
+    - Returns: The number of live entities. */
+    size_t EntityIndex::size() const {
+        return dense.size();
+    }
+
+    /* Capacity
+    - Returns: The number of slot indices ever allocated, live or free. */
+    size_t EntityIndex::capacity() const {
+        return generations.size();
+    }
+
+    /* Reserve
+    - Reserves storage for a number of live entities.
+    - Parameters:
+        - count: The number of entities to reserve for. */
+    void EntityIndex::reserve(size_t count) {
+        dense.reserve(count);
+        sparse.reserve(count);
+        generations.reserve(count);
+    }
+
+    /* Get Entities
+    - Returns: The live entities, in no particular order. */
+    const std::vector<omelette::ecs::Entity>& EntityIndex::getEntities() const {
+        return dense;
+    }
+}; // namespace omelette::ecs
@@ -0,0 +1,63 @@
+#ifndef OMELETTE_ECS_ENTITYINDEX_HPP
+#define OMELETTE_ECS_ENTITYINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Entity.hpp"
+
+namespace omelette::ecs {
+    // Sparse set of live entity handles. Slots are recycled through a free
+    // list with a bumped generation, and every lookup is a couple of flat
+    // array reads.
+    class EntityIndex {
+      private:
+        // Live entities, packed for iteration
+        std::vector<omelette::ecs::Entity> dense;
+
+        // Position in the dense array of each slot index
+        std::vector<uint32_t> sparse;
+
+        // Current generation of each slot index
+        std::vector<uint32_t> generations;
+
+        // Slot indices available for reuse
+        std::vector<uint32_t> freeIndices;
+
+      public:
+        // Create a new entity handle, recycling a free slot if possible
+        omelette::ecs::Entity create();
+
+        // Destroy an entity handle; returns false if it was stale
+        bool destroy(omelette::ecs::Entity entity);
+
+        // Check whether a handle refers to a live entity
+        bool isAlive(omelette::ecs::Entity entity) const;
+
+        // Number of live entities
+        size_t size() const;
+
+        // Number of slot indices ever allocated
+        size_t capacity() const;
+
+        // Reserve storage for a number of entities
+        void reserve(size_t count);
+
+        // Get the live entities
+        const std::vector<omelette::ecs::Entity>& getEntities() const;
+    };
+
+    /* Is Alive
+    - Checks whether a handle refers to a live entity.
+    - Parameters:
+        - entity: The handle to check.
+    - Returns: True if the slot exists and its generation matches. */
+    inline bool EntityIndex::isAlive(omelette::ecs::Entity entity) const {
+        const uint32_t index = entity.index();
+        return index < generations.size()
+            && generations[index] == entity.generation();
+    }
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_ENTITYINDEX_HPP
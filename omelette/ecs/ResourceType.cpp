@@ -0,0 +1,29 @@
+#include "ResourceType.hpp"
+
+#include <stdexcept>
+
+namespace omelette::ecs {
+    std::atomic<ResourceTypeId> ResourceRegistry::nextId{0};
+
+    /* Register Type
+    - Assigns the next free resource type id. Called once per type by
+      getResourceTypeId, from any thread.
+    - Returns: The new id. */
+    ResourceTypeId ResourceRegistry::registerType() {
+        const ResourceTypeId id =
+            nextId.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MAX_RESOURCE_TYPES) {
+            throw std::length_error(
+                "ResourceRegistry: more than MAX_RESOURCE_TYPES types"
+            );
+        }
+        return id;
+    }
+
+    /* Get Type Count
+    - Returns: The number of resource type ids assigned so far. */
+    size_t ResourceRegistry::getTypeCount() {
+        const size_t count = nextId.load(std::memory_order_relaxed);
+        return count < MAX_RESOURCE_TYPES ? count : MAX_RESOURCE_TYPES;
+    }
+}; // namespace omelette::ecs
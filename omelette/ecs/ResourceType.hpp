@@ -0,0 +1,56 @@
+#ifndef OMELETTE_ECS_RESOURCETYPE_HPP
+#define OMELETTE_ECS_RESOURCETYPE_HPP
+
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace omelette::ecs {
+    // Dense id of a resource type: data shared between systems outside the
+    // ECS, such as a pair list one system produces and another consumes.
+    // Resources have their own id space, so they never use up component ids.
+    using ResourceTypeId = uint32_t;
+
+    // Resource types a program can use; the width of a ResourceSet
+    constexpr size_t MAX_RESOURCE_TYPES = 64;
+
+    // Set of resource types as one bit per type id
+    using ResourceSet = std::bitset<MAX_RESOURCE_TYPES>;
+
+    // Hands out resource type ids in order of first use
+    class ResourceRegistry {
+      public:
+        // Assign the next id; throws std::length_error once every id of
+        // MAX_RESOURCE_TYPES is taken
+        static ResourceTypeId registerType();
+
+        // Number of ids assigned so far
+        static size_t getTypeCount();
+
+      private:
+        static std::atomic<ResourceTypeId> nextId;
+    };
+
+    // Id of a resource type; const and non-const T share one id
+    template<typename T>
+    ResourceTypeId getResourceTypeId() {
+        if constexpr (!std::is_same_v<T, std::remove_cv_t<T>>) {
+            return getResourceTypeId<std::remove_cv_t<T>>();
+        } else {
+            static const ResourceTypeId id = ResourceRegistry::registerType();
+            return id;
+        }
+    }
+
+    // Build the set of a list of resource types
+    template<typename... Ts>
+    ResourceSet makeResourceSet() {
+        ResourceSet resources;
+        (resources.set(getResourceTypeId<Ts>()), ...);
+        return resources;
+    }
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_RESOURCETYPE_HPP
@@ -0,0 +1,129 @@
+#include "Scheduler.hpp"
+
+#include "../utils/Profiler.hpp"
+
+namespace omelette::ecs {
+    /* Scheduler Constructor
+    - Creates the thread pool.
+    - Parameters:
+        - threadCount: Threads to run systems on, including the caller of
+          run(). Zero uses every hardware thread. */
+    Scheduler::Scheduler(size_t threadCount) : threadPool(threadCount) {}
+
+    /* Add System
+    - Registers a system. Systems that conflict run in registration order.
+    - Parameters:
+        - system: The system to add.
+    - Returns: Reference to the registered system. */
+    omelette::ecs::System&
+    Scheduler::addSystem(std::unique_ptr<omelette::ecs::System> system) {
+        systems.push_back(std::move(system));
+        graphDirty = true;
+        return *systems.back();
+    }
+
+    /* Build Graph
+    - Collects every system's access set and adds an edge from each system
+      to every later system it conflicts with. */
+    void Scheduler::buildGraph() {
+        const size_t count = systems.size();
+
+        accesses.resize(count);
+        successors.resize(count);
+        dependencyCounts.assign(count, 0);
+        for (size_t i = 0; i < count; i++) {
+            accesses[i] = systems[i]->getAccess();
+            successors[i].clear();
+        }
+
+        if (dependencyCapacity < count) {
+            remainingDependencies =
+                std::make_unique<std::atomic<size_t>[]>(count);
+            dependencyCapacity = count;
+        }
+
+        for (size_t j = 0; j < count; j++) {
+            for (size_t i = 0; i < j; i++) {
+                if (accesses[i].conflictsWith(accesses[j])) {
+                    successors[i].push_back(j);
+                    dependencyCounts[j]++;
+                }
+            }
+        }
+        graphDirty = false;
+    }
+
+    /* Launch
+    - Queues a system on the pool. When it finishes, every successor whose
+      last dependency it was is launched in turn.
+    - Parameters:
+        - systemIndex: The system to run. */
+    void Scheduler::launch(size_t systemIndex) {
+        threadPool.submit(
+            [this, systemIndex]() {
+                systems[systemIndex]
+                    ->update(*currentECS, currentDeltaTime, threadPool);
+
+                for (size_t successor : successors[systemIndex]) {
+                    if (remainingDependencies[successor].fetch_sub(
+                            1,
+                            std::memory_order_acq_rel
+                        )
+                        == 1) {
+                        launch(successor);
+                    }
+                }
+            },
+            *currentGroup
+        );
+    }
+
+    /* Run
+    - Runs every system once. Systems without conflicts run concurrently.
+      Once all have finished, the commands they recorded in the ECS's
+      command buffer are applied and the ECS's frame arena is reset, so
+      scratch data systems allocated from it is freed.
+    - Parameters:
+        - ecs: The ECS to run the systems on.
+        - deltaTime: Time elapsed since last frame. */
+    void Scheduler::run(omelette::ecs::ECS& ecs, float deltaTime) {
+        OMELETTE_PROFILE_ZONE("Scheduler::run");
+        if (graphDirty) {
+            buildGraph();
+        }
+        for (size_t i = 0; i < systems.size(); i++) {
+            remainingDependencies[i].store(
+                dependencyCounts[i],
+                std::memory_order_relaxed
+            );
+        }
+
+        omelette::utils::TaskGroup group;
+        currentECS = &ecs;
+        currentDeltaTime = deltaTime;
+        currentGroup = &group;
+        for (size_t i = 0; i < systems.size(); i++) {
+            if (dependencyCounts[i] == 0) {
+                launch(i);
+            }
+        }
+        threadPool.wait(group);
+        currentGroup = nullptr;
+
+        ecs.applyCommands();
+        ecs.getFrameArena().reset();
+    }
+
+    /* Get Thread Pool
+    - Returns: The thread pool used by the scheduler. */
+    omelette::utils::ThreadPool& Scheduler::getThreadPool() {
+        return threadPool;
+    }
+
+    /* Get Successors
+    - Returns: For each system, the later systems that wait for it. The
+      graph is built by the first run() after a system is added. */
+    const std::vector<std::vector<size_t>>& Scheduler::getSuccessors() const {
+        return successors;
+    }
+}; // namespace omelette::ecs
@@ -0,0 +1,86 @@
+#ifndef OMELETTE_ECS_SCHEDULER_HPP
+#define OMELETTE_ECS_SCHEDULER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../utils/ThreadPool.hpp"
+#include "ECS.hpp"
+#include "System.hpp"
+
+namespace omelette::ecs {
+    // Runs systems in parallel where their declared component access allows.
+    // The scheduler builds a dependency graph in which a system waits for
+    // every earlier-registered system it conflicts with, rebuilt only when
+    // systems are added, and each frame runs ready systems on a
+    // work-stealing thread pool. Once warm, a frame allocates nothing.
+    class Scheduler {
+      private:
+        // Registered systems, in registration order
+        std::vector<std::unique_ptr<omelette::ecs::System>> systems;
+
+        // Pool running systems and their parallel query chunks
+        omelette::utils::ThreadPool threadPool;
+
+        // Dependency graph of the registered systems
+        std::vector<omelette::ecs::ComponentAccess> accesses;
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> dependencyCounts;
+        bool graphDirty = true;
+
+        // Dependencies each system still waits for in the current frame
+        std::unique_ptr<std::atomic<size_t>[]> remainingDependencies;
+        size_t dependencyCapacity = 0;
+
+        // Arguments of the current run(), kept here so launched tasks only
+        // capture an index and fit std::function's inline storage
+        omelette::ecs::ECS* currentECS = nullptr;
+        float currentDeltaTime = 0.0f;
+        omelette::utils::TaskGroup* currentGroup = nullptr;
+
+        // Build the dependency graph for the current systems
+        void buildGraph();
+
+        // Queue a system whose dependencies have finished
+        void launch(size_t systemIndex);
+
+      public:
+        // Create a scheduler; zero threads uses every hardware thread
+        explicit Scheduler(size_t threadCount = 0);
+
+        // Register a system; systems that conflict run in this order
+        omelette::ecs::System&
+        addSystem(std::unique_ptr<omelette::ecs::System> system);
+
+        template<typename T, typename... Args>
+        T& addSystem(Args&&... args);
+
+        // Run every system once and return when all have finished
+        void run(omelette::ecs::ECS& ecs, float deltaTime);
+
+        // Get the thread pool used by the scheduler
+        omelette::utils::ThreadPool& getThreadPool();
+
+        // Get the later systems waiting on each system
+        const std::vector<std::vector<size_t>>& getSuccessors() const;
+    };
+
+    /* Add System
+    - Constructs and registers a system.
+    - Template Parameters:
+        - T: The system type.
+    - Parameters:
+        - args: Arguments forwarded to the system's constructor.
+    - Returns: Reference to the registered system. */
+    template<typename T, typename... Args>
+    T& Scheduler::addSystem(Args&&... args) {
+        return static_cast<T&>(
+            addSystem(std::make_unique<T>(std::forward<Args>(args)...))
+        );
+    }
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_SCHEDULER_HPP
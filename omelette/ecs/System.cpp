@@ -0,0 +1,22 @@
+#include "System.hpp"
+
+namespace omelette::ecs {
+    /* Conflicts With
+    - Checks whether two access sets forbid running their systems at the
+      same time: either is exclusive, or one writes a component or resource
+      type the other reads or writes.
+    - Parameters:
+        - other: The access set of the other system.
+    - Returns: True if the systems must run one after the other. */
+    bool ComponentAccess::conflictsWith(const ComponentAccess& other) const {
+        if (exclusive || other.exclusive) {
+            return true;
+        }
+        return writes.intersects(other.writes)
+            || writes.intersects(other.reads)
+            || reads.intersects(other.writes)
+            || (resourceWrites & other.resourceWrites).any()
+            || (resourceWrites & other.resourceReads).any()
+            || (resourceReads & other.resourceWrites).any();
+    }
+}; // namespace omelette::ecs
@@ -0,0 +1,83 @@
+#ifndef OMELETTE_ECS_SYSTEM_HPP
+#define OMELETTE_ECS_SYSTEM_HPP
+
+#include "../utils/ThreadPool.hpp"
+#include "ComponentType.hpp"
+#include "ResourceType.hpp"
+
+namespace omelette::ecs {
+    class ECS;
+
+    // Component and resource types a system reads and writes. The scheduler
+    // runs two systems concurrently only if neither writes what the other
+    // touches. Data shared between systems outside the ECS, such as a pair
+    // list one system produces and another consumes, is declared as a
+    // resource, which has its own id space apart from component types.
+    class ComponentAccess {
+      public:
+        omelette::ecs::Signature reads; // Component types read
+        omelette::ecs::Signature writes; // Component types written
+        omelette::ecs::ResourceSet resourceReads; // Resource types read
+        omelette::ecs::ResourceSet resourceWrites; // Resource types written
+        bool exclusive = false; // Needs the whole ECS (structural changes)
+
+        // Declare read-only access to component types
+        template<typename... Ts>
+        ComponentAccess& read() {
+            reads.merge(omelette::ecs::makeSignature<Ts...>());
+            return *this;
+        }
+
+        // Declare read-write access to component types
+        template<typename... Ts>
+        ComponentAccess& write() {
+            writes.merge(omelette::ecs::makeSignature<Ts...>());
+            return *this;
+        }
+
+        // Declare read-only access to resource types
+        template<typename... Ts>
+        ComponentAccess& readResource() {
+            resourceReads |= omelette::ecs::makeResourceSet<Ts...>();
+            return *this;
+        }
+
+        // Declare read-write access to resource types
+        template<typename... Ts>
+        ComponentAccess& writeResource() {
+            resourceWrites |= omelette::ecs::makeResourceSet<Ts...>();
+            return *this;
+        }
+
+        // Declare that the system adds or removes entities or components
+        // directly; recording them in ecs.getCommandBuffer() instead
+        // defers them to the end of the frame and needs no exclusivity
+        ComponentAccess& makeExclusive() {
+            exclusive = true;
+            return *this;
+        }
+
+        // Check whether two systems may not run at the same time
+        bool conflictsWith(const ComponentAccess& other) const;
+    };
+
+    // Unit of per-frame logic run by the Scheduler
+    class System {
+      public:
+        // Virtual destructor for polymorphic deletion
+        virtual ~System() = default;
+
+        // Component types the system reads and writes; must not change
+        // once the system is added, as the scheduler caches it
+        virtual ComponentAccess getAccess() const = 0;
+
+        // Run the system; large queries may be split across the pool
+        virtual void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) = 0;
+    };
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_SYSTEM_HPP
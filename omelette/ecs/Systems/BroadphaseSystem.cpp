@@ -0,0 +1,158 @@
+#include "BroadphaseSystem.hpp"
+
+#include "../../utils/Profiler.hpp"
+#include "../Components/ColliderComponent.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::ColliderComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+
+    /* BroadphaseSystem Constructor
+    - Parameters:
+        - type: The broadphase implementation to use.
+        - margin: Distance the fat AABBs extend past the tight ones. */
+    BroadphaseSystem::BroadphaseSystem(
+        omelette::physics::BroadphaseType type,
+        float margin
+    ) :
+        broadphase(omelette::physics::createBroadphase(type, margin)),
+        type(type),
+        margin(margin) {}
+
+    /* Get Access
+    - Returns: Read access to colliders and rigid bodies, and write access
+      to the pair list. */
+    omelette::ecs::ComponentAccess BroadphaseSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess()
+            .read<ColliderComponent, RigidBodyComponent>()
+            .writeResource<omelette::physics::BroadphasePair>();
+    }
+
+    /* Update
+    - Computes each collider's tight AABB, its shape's precomputed bounds
+      moved to the rigid body position, across the thread pool, predicting
+      the next step's motion from the body velocity. These are the shapes
+      and positions the narrowphase tests. The proxies are
+      then created or moved in one serial pass, since the broadphase is not
+      thread-safe. Sleeping bodies keep their proxy without a refit.
+      Proxies of entities that were destroyed or lost their collider or
+      body are removed, then the overlapping pairs are recomputed.
+    - Parameters:
+        - ecs: The ECS holding the colliders and bodies.
+        - deltaTime: The time step, used to predict displacement.
+        - threadPool: The pool to compute the bounds on. */
+    void BroadphaseSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("BroadphaseSystem::update");
+        frame++;
+        if (proxies.size() < ecs.getEntityCapacity()) {
+            proxies.resize(ecs.getEntityCapacity());
+        }
+
+        const auto view =
+            ecs.view<const ColliderComponent, const RigidBodyComponent>();
+
+        // Each entity only writes its own slot, so chunks run in parallel
+        view.parallelEachChunk(
+            threadPool,
+            [this, deltaTime](
+                size_t count,
+                const omelette::ecs::Entity* entities,
+                const ColliderComponent* colliders,
+                const RigidBodyComponent* bodies
+            ) {
+                for (size_t i = 0; i < count; i++) {
+                    Proxy& proxy = proxies[entities[i].index()];
+                    const bool tracked =
+                        proxy.id != NO_PROXY && proxy.entity == entities[i];
+                    if (bodies[i].sleeping && tracked) {
+                        continue;
+                    }
+                    proxy.aabb = colliders[i].shape.bounds.translated(
+                        bodies[i].position
+                    );
+                    proxy.displacement = bodies[i].velocity * deltaTime;
+                }
+            }
+        );
+
+        view.each(
+            [&](
+                omelette::ecs::Entity entity,
+                const ColliderComponent&,
+                const RigidBodyComponent& body
+            ) {
+                Proxy& proxy = proxies[entity.index()];
+                if (proxy.id != NO_PROXY && proxy.entity != entity) {
+                    // The slot was recycled: drop the old entity's proxy
+                    broadphase->destroyProxy(proxy.id);
+                    proxy.id = NO_PROXY;
+                }
+
+                if (proxy.id == NO_PROXY) {
+                    proxy.entity = entity;
+                    proxy.id = broadphase->createProxy(proxy.aabb, entity);
+                } else if (!body.sleeping) {
+                    broadphase->moveProxy(
+                        proxy.id,
+                        proxy.aabb,
+                        proxy.displacement
+                    );
+                }
+                proxy.frame = frame;
+            }
+        );
+
+        for (auto& proxy : proxies) {
+            if (proxy.id != NO_PROXY && proxy.frame != frame) {
+                broadphase->destroyProxy(proxy.id);
+                proxy.id = NO_PROXY;
+            }
+        }
+
+        broadphase->computePairs(pairs);
+        OMELETTE_PROFILE_COUNTER("broadphase pairs", pairs.size());
+    }
+
+    /* Set Broadphase Type
+    - Replaces the broadphase. Every proxy is recreated on the next update.
+    - Parameters:
+        - type: The broadphase implementation to use. */
+    void BroadphaseSystem::setBroadphaseType(
+        omelette::physics::BroadphaseType type
+    ) {
+        if (type == this->type) {
+            return;
+        }
+        this->type = type;
+        broadphase = omelette::physics::createBroadphase(type, margin);
+        proxies.clear();
+        pairs.clear();
+    }
+
+    /* Get Broadphase Type
+    - Returns: The broadphase implementation in use. */
+    omelette::physics::BroadphaseType
+    BroadphaseSystem::getBroadphaseType() const {
+        return type;
+    }
+
+    /* Get Broadphase
+    - Returns: The broadphase holding the proxies. */
+    const omelette::physics::Broadphase&
+    BroadphaseSystem::getBroadphase() const {
+        return *broadphase;
+    }
+
+    /* Get Pairs
+    - Returns: The overlapping pairs from the last update, sorted. */
+    const std::vector<omelette::physics::BroadphasePair>&
+    BroadphaseSystem::getPairs() const {
+        return pairs;
+    }
+}; // namespace omelette::ecs::systems
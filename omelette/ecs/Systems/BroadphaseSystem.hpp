@@ -0,0 +1,69 @@
+#ifndef OMELETTE_ECS_SYSTEMS_BROADPHASESYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_BROADPHASESYSTEM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../../physics/Broadphase.hpp"
+#include "../../utils/AABB.hpp"
+#include "../../utils/Vec3.hpp"
+#include "../System.hpp"
+
+namespace omelette::ecs::systems {
+    // Keeps a broadphase proxy for every entity with a collider and a rigid
+    // body and collects the pairs of entities whose fat AABBs overlap
+    class BroadphaseSystem: public omelette::ecs::System {
+      private:
+        // Marks entity slots without a proxy
+        static constexpr omelette::physics::ProxyId NO_PROXY = -1;
+
+        struct Proxy {
+            omelette::ecs::Entity entity; // Entity the proxy belongs to
+            omelette::physics::ProxyId id = NO_PROXY; // Handle in broadphase
+            uint32_t frame = 0; // Last frame the entity was seen
+            omelette::utils::AABB aabb; // Tight AABB of this update
+            omelette::utils::Vec3 displacement; // Predicted motion
+        };
+
+        std::unique_ptr<omelette::physics::Broadphase> broadphase;
+        omelette::physics::BroadphaseType type;
+        float margin;
+
+        // Proxy of every tracked entity, by entity index
+        std::vector<Proxy> proxies;
+
+        // Overlapping pairs from the last update
+        std::vector<omelette::physics::BroadphasePair> pairs;
+
+        // Incremented every update to find entities that disappeared
+        uint32_t frame = 0;
+
+      public:
+        explicit BroadphaseSystem(
+            omelette::physics::BroadphaseType type =
+                omelette::physics::BroadphaseType::DynamicTree,
+            float margin = 0.1f
+        );
+
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Refresh every proxy and recompute the overlapping pairs
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+
+        // Switch broadphase implementation; proxies are rebuilt next update
+        void setBroadphaseType(omelette::physics::BroadphaseType type);
+
+        // Getters
+        omelette::physics::BroadphaseType getBroadphaseType() const;
+        const omelette::physics::Broadphase& getBroadphase() const;
+        const std::vector<omelette::physics::BroadphasePair>& getPairs() const;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_BROADPHASESYSTEM_HPP
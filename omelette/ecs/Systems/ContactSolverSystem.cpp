@@ -0,0 +1,186 @@
+#include "ContactSolverSystem.hpp"
+
+#include "../../utils/Profiler.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::RigidBodyComponent;
+
+    namespace {
+        // Marks entity slots that hold no body in the solver input
+        constexpr uint32_t NO_BODY = UINT32_MAX;
+    } // namespace
+
+    /* ContactSolverSystem Constructor
+    - Parameters:
+        - narrowphase: The system whose contacts are solved.
+        - settings: The solver tuning. */
+    ContactSolverSystem::ContactSolverSystem(
+        const NarrowphaseSystem& narrowphase,
+        const omelette::physics::SolverSettings& settings
+    ) :
+        narrowphase(narrowphase),
+        solver(settings) {}
+
+    /* Get Access
+    - Returns: Read access to the contacts and write access to rigid
+      bodies. */
+    omelette::ecs::ComponentAccess ContactSolverSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess()
+            .readResource<omelette::physics::ContactPair>()
+            .write<RigidBodyComponent>();
+    }
+
+    /* Add Body
+    - Adds an entity's rigid body to the solver input once. The solver sees
+      the velocity after this step's acceleration is applied, so contacts
+      cancel gravity in the same step. Bodies with non-positive mass and
+      sleeping bodies are static.
+    - Parameters:
+        - ecs: The ECS holding the rigid bodies.
+        - entity: The entity to add.
+        - deltaTime: The time step.
+    - Returns: The body's index in the solver input. */
+    uint32_t ContactSolverSystem::addBody(
+        omelette::ecs::ECS& ecs,
+        omelette::ecs::Entity entity,
+        float deltaTime
+    ) {
+        if (entity.index() >= bodyIndices.size()) {
+            bodyIndices.resize(entity.index() + 1, NO_BODY);
+        }
+        uint32_t& index = bodyIndices[entity.index()];
+        if (index != NO_BODY) {
+            return index;
+        }
+        index = static_cast<uint32_t>(bodies.size());
+
+        const auto* rigidBody = ecs.getComponent<RigidBodyComponent>(entity);
+        if (rigidBody->mass > 0.0f && !rigidBody->sleeping) {
+            bodies.push_back({
+                rigidBody->velocity + rigidBody->acceleration * deltaTime,
+                1.0f / rigidBody->mass,
+                utils::Vec3()
+            });
+        } else {
+            bodies.push_back({rigidBody->velocity, 0.0f, utils::Vec3()});
+        }
+        bodyEntities.push_back(entity);
+        return index;
+    }
+
+    /* Update
+    - Refreshes every manifold with the current positions, merges in the
+      new contacts and drops manifolds left without points. A manifold
+      outlives its pair's last contact until its points drift apart, so
+      bodies resting at the edge of contact keep their warm-start impulses.
+      Manifolds with a body that can move are then solved; the velocities
+      are written back and the penetration correction is applied to the
+      positions directly. Acceleration is left for the integration system
+      to apply.
+    - Parameters:
+        - ecs: The ECS holding the rigid bodies.
+        - deltaTime: The time step.
+        - threadPool: The pool to run solver batches on. */
+    void ContactSolverSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("ContactSolverSystem::update");
+        for (auto entity : bodyEntities) {
+            bodyIndices[entity.index()] = NO_BODY;
+        }
+        bodies.clear();
+        bodyEntities.clear();
+        constraints.clear();
+
+        manifolds.eraseIf(
+            [&](
+                const omelette::physics::BroadphasePair& pair,
+                omelette::physics::ContactManifold& manifold
+            ) {
+                const auto* bodyA =
+                    ecs.getComponent<RigidBodyComponent>(pair.a);
+                const auto* bodyB =
+                    ecs.getComponent<RigidBodyComponent>(pair.b);
+                if (!bodyA || !bodyB) {
+                    return true;
+                }
+                manifold.refresh(bodyA->position, bodyB->position);
+                return false;
+            }
+        );
+
+        for (const auto& contact : narrowphase.getContacts()) {
+            const auto* bodyA = ecs.getComponent<RigidBodyComponent>(contact.a);
+            const auto* bodyB = ecs.getComponent<RigidBodyComponent>(contact.b);
+            if (!bodyA || !bodyB) {
+                continue;
+            }
+            manifolds[{contact.a, contact.b}].addContact(
+                contact.contact,
+                bodyA->position,
+                bodyB->position
+            );
+        }
+
+        // Bodies that can move this step
+        auto active = [&](omelette::ecs::Entity entity) {
+            const auto* body = ecs.getComponent<RigidBodyComponent>(entity);
+            return body->mass > 0.0f && !body->sleeping;
+        };
+
+        manifolds.eraseIf([](const auto&, const auto& manifold) {
+            return manifold.pointCount == 0;
+        });
+        manifolds.forEach(
+            [&](
+                const omelette::physics::BroadphasePair& pair,
+                omelette::physics::ContactManifold& manifold
+            ) {
+                if (!active(pair.a) && !active(pair.b)) {
+                    return;
+                }
+                constraints.push_back({
+                    addBody(ecs, pair.a, deltaTime),
+                    addBody(ecs, pair.b, deltaTime),
+                    &manifold
+                });
+            }
+        );
+
+        solver.solve(
+            bodies,
+            constraints,
+            deltaTime,
+            threadPool,
+            &ecs.getFrameArena()
+        );
+        OMELETTE_PROFILE_COUNTER("contact constraints", constraints.size());
+
+        for (size_t i = 0; i < bodies.size(); i++) {
+            if (bodies[i].inverseMass <= 0.0f) {
+                continue;
+            }
+            auto* rigidBody =
+                ecs.getComponent<RigidBodyComponent>(bodyEntities[i]);
+            rigidBody->velocity =
+                bodies[i].velocity - rigidBody->acceleration * deltaTime;
+            rigidBody->position += bodies[i].pseudoVelocity * deltaTime;
+        }
+    }
+
+    /* Get Solver
+    - Returns: The contact solver, to inspect or tune it. */
+    omelette::physics::ContactSolver& ContactSolverSystem::getSolver() {
+        return solver;
+    }
+
+    /* Get Manifold Count
+    - Returns: The number of pairs currently in contact. */
+    size_t ContactSolverSystem::getManifoldCount() const {
+        return manifolds.size();
+    }
+}; // namespace omelette::ecs::systems
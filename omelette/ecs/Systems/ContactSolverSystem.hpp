@@ -0,0 +1,69 @@
+#ifndef OMELETTE_ECS_SYSTEMS_CONTACTSOLVERSYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_CONTACTSOLVERSYSTEM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../physics/ContactManifold.hpp"
+#include "../../physics/ContactSolver.hpp"
+#include "../../utils/FlatHashMap.hpp"
+#include "../System.hpp"
+#include "NarrowphaseSystem.hpp"
+
+namespace omelette::ecs::systems {
+    // Keeps a contact manifold for every touching pair and resolves the
+    // contacts by adjusting rigid body velocities. Must be registered after
+    // the narrowphase system it reads from and before the integration
+    // system, so the corrected velocities are integrated the same step.
+    class ContactSolverSystem: public omelette::ecs::System {
+      private:
+        const NarrowphaseSystem& narrowphase;
+
+        omelette::physics::ContactSolver solver;
+
+        // Manifold of every pair in or near contact, kept across frames
+        omelette::utils::FlatHashMap<
+            omelette::physics::BroadphasePair,
+            omelette::physics::ContactManifold>
+            manifolds;
+
+        // Solver input, rebuilt every update
+        std::vector<omelette::physics::ContactSolver::Body> bodies;
+        std::vector<omelette::physics::ContactSolver::Constraint> constraints;
+        std::vector<omelette::ecs::Entity> bodyEntities;
+
+        // Index of every entity's body in the solver input, by entity
+        // index; only the entries of bodyEntities are set between updates
+        std::vector<uint32_t> bodyIndices;
+
+        // Index of an entity's body in the solver input, adding it if needed
+        uint32_t addBody(
+            omelette::ecs::ECS& ecs,
+            omelette::ecs::Entity entity,
+            float deltaTime
+        );
+
+      public:
+        explicit ContactSolverSystem(
+            const NarrowphaseSystem& narrowphase,
+            const omelette::physics::SolverSettings& settings = {}
+        );
+
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Update the manifolds and solve them
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+
+        // Getters
+        omelette::physics::ContactSolver& getSolver();
+        size_t getManifoldCount() const;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_CONTACTSOLVERSYSTEM_HPP
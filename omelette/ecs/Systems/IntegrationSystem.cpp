@@ -0,0 +1,65 @@
+#include "IntegrationSystem.hpp"
+
+#include "../../physics/Integrator.hpp"
+#include "../../utils/Profiler.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::RigidBodyComponent;
+
+    /* Get Access
+    - Returns: Write access to rigid bodies. */
+    omelette::ecs::ComponentAccess IntegrationSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess().write<RigidBodyComponent>();
+    }
+
+    /* Update
+    - Integrates every awake rigid body in place with the batched
+      integrator, splitting large archetypes across the thread pool. Sleeping bodies
+      are skipped, so contiguous runs of awake bodies are integrated.
+    - Parameters:
+        - ecs: The ECS holding the rigid bodies.
+        - deltaTime: The time step to integrate by.
+        - threadPool: The pool to run chunks on. */
+    void IntegrationSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("IntegrationSystem::update");
+        ecs.view<RigidBodyComponent>().parallelEachChunk(
+            threadPool,
+            [deltaTime](
+                size_t count,
+                const omelette::ecs::Entity*,
+                RigidBodyComponent* bodies
+            ) {
+                // Integrate each run of awake bodies, skipping sleepers
+                size_t begin = 0;
+                while (begin < count) {
+                    while (begin < count && bodies[begin].sleeping) {
+                        begin++;
+                    }
+                    size_t end = begin;
+                    while (end < count && !bodies[end].sleeping) {
+                        end++;
+                    }
+                    if (end > begin) {
+                        omelette::physics::Integrator::integrate(
+                            bodies + begin,
+                            end - begin,
+                            deltaTime
+                        );
+                        OMELETTE_PROFILE_COUNTER(
+                            "bodies integrated",
+                            end - begin
+                        );
+                    }
+                    begin = end;
+                }
+            },
+            4096
+        );
+    }
+}; // namespace omelette::ecs::systems
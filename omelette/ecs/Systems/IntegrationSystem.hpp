@@ -0,0 +1,22 @@
+#ifndef OMELETTE_ECS_SYSTEMS_INTEGRATIONSYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_INTEGRATIONSYSTEM_HPP
+
+#include "../System.hpp"
+
+namespace omelette::ecs::systems {
+    // Integrates the velocity and position of every rigid body
+    class IntegrationSystem: public omelette::ecs::System {
+      public:
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Integrate every rigid body, in parallel batches
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_INTEGRATIONSYSTEM_HPP
@@ -0,0 +1,165 @@
+#include "IslandSystem.hpp"
+
+#include <algorithm>
+
+#include "../../utils/Profiler.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::RigidBodyComponent;
+
+    namespace {
+        // Marks entity slots that hold no dynamic body
+        constexpr uint32_t NO_BODY = UINT32_MAX;
+    } // namespace
+
+    /* IslandSystem Constructor
+    - Parameters:
+        - narrowphase: The system whose contacts link bodies.
+        - settings: The sleep tuning. */
+    IslandSystem::IslandSystem(
+        const NarrowphaseSystem& narrowphase,
+        const SleepSettings& settings
+    ) :
+        narrowphase(narrowphase),
+        settings(settings) {}
+
+    /* Get Access
+    - Returns: Read access to the contacts and write access to rigid
+      bodies. */
+    omelette::ecs::ComponentAccess IslandSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess()
+            .readResource<omelette::physics::ContactPair>()
+            .write<RigidBodyComponent>();
+    }
+
+    /* Update
+    - Advances the sleep timer of every awake dynamic body, links bodies
+      touching each other and visits each island. An island holding both
+      awake and sleeping bodies was just touched, so all of it wakes. An
+      awake island whose bodies have all been still for timeToSleep falls
+      asleep with its velocities zeroed. Static bodies (non-positive mass)
+      are never linked, so a shared floor does not merge islands.
+    - Parameters:
+        - ecs: The ECS holding the rigid bodies.
+        - deltaTime: The time step.
+        - threadPool: Unused. */
+    void IslandSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("IslandSystem::update");
+        const float threshold =
+            settings.velocityThreshold * settings.velocityThreshold;
+
+        bodies.clear();
+        std::fill(bodyIndices.begin(), bodyIndices.end(), NO_BODY);
+        ecs.view<RigidBodyComponent>().each(
+            [&](omelette::ecs::Entity entity, RigidBodyComponent& body) {
+                if (body.mass <= 0.0f) {
+                    return;
+                }
+                if (entity.index() >= bodyIndices.size()) {
+                    bodyIndices.resize(entity.index() + 1, NO_BODY);
+                }
+                bodyIndices[entity.index()] =
+                    static_cast<uint32_t>(bodies.size());
+                bodies.push_back(&body);
+
+                if (!body.sleeping) {
+                    if (body.velocity.dot(body.velocity) > threshold) {
+                        body.sleepTime = 0.0f;
+                    } else {
+                        body.sleepTime += deltaTime;
+                    }
+                }
+            }
+        );
+
+        // Index of a contact's body, if it is a dynamic body of this update
+        auto indexOf = [&](omelette::ecs::Entity entity) {
+            return entity.index() < bodyIndices.size()
+                ? bodyIndices[entity.index()]
+                : NO_BODY;
+        };
+
+        islands.reset(bodies.size());
+        for (const auto& contact : narrowphase.getContacts()) {
+            const uint32_t bodyA = indexOf(contact.a);
+            const uint32_t bodyB = indexOf(contact.b);
+            if (bodyA != NO_BODY && bodyB != NO_BODY) {
+                islands.link(bodyA, bodyB);
+            }
+        }
+        islands.build(&ecs.getFrameArena());
+        OMELETTE_PROFILE_COUNTER("islands", islands.getIslandCount());
+
+        const auto& islandBodies = islands.getBodies();
+        const auto& offsets = islands.getOffsets();
+        sleepingCount = 0;
+        for (size_t island = 0; island < islands.getIslandCount(); island++) {
+            const size_t begin = offsets[island];
+            const size_t end = offsets[island + 1];
+
+            bool anyAwake = false;
+            bool anySleeping = false;
+            float minSleepTime = settings.timeToSleep;
+            for (size_t i = begin; i < end; i++) {
+                const RigidBodyComponent& body = *bodies[islandBodies[i]];
+                if (body.sleeping) {
+                    anySleeping = true;
+                } else {
+                    anyAwake = true;
+                    minSleepTime = std::min(minSleepTime, body.sleepTime);
+                }
+            }
+
+            if (anyAwake && anySleeping) {
+                for (size_t i = begin; i < end; i++) {
+                    RigidBodyComponent& body = *bodies[islandBodies[i]];
+                    if (body.sleeping) {
+                        body.wake();
+                    }
+                }
+            } else if (anyAwake && settings.enabled
+                       && minSleepTime >= settings.timeToSleep) {
+                for (size_t i = begin; i < end; i++) {
+                    RigidBodyComponent& body = *bodies[islandBodies[i]];
+                    body.sleeping = true;
+                    body.velocity = utils::Vec3();
+                    body.acceleration = utils::Vec3();
+                }
+                sleepingCount += end - begin;
+            } else if (anySleeping) {
+                sleepingCount += end - begin;
+            }
+        }
+    }
+
+    /* Get Settings
+    - Returns: The sleep tuning. */
+    const SleepSettings& IslandSystem::getSettings() const {
+        return settings;
+    }
+
+    /* Set Settings
+    - Parameters:
+        - settings: The new sleep tuning. */
+    void IslandSystem::setSettings(const SleepSettings& settings) {
+        this->settings = settings;
+    }
+
+    /* Get Island Count
+    - Returns: The number of islands found in the last update, including
+      single bodies touching nothing. */
+    size_t IslandSystem::getIslandCount() const {
+        return islands.getIslandCount();
+    }
+
+    /* Get Sleeping Count
+    - Returns: The number of dynamic bodies asleep after the last update. */
+    size_t IslandSystem::getSleepingCount() const {
+        return sleepingCount;
+    }
+}; // namespace omelette::ecs::systems
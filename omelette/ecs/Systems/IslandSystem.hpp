@@ -0,0 +1,70 @@
+#ifndef OMELETTE_ECS_SYSTEMS_ISLANDSYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_ISLANDSYSTEM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../physics/IslandBuilder.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../System.hpp"
+#include "NarrowphaseSystem.hpp"
+
+namespace omelette::ecs::systems {
+    // Tuning of body sleeping
+    struct SleepSettings {
+        bool enabled = true; // Whether islands may fall asleep
+        float velocityThreshold = 0.05f; // Speed below which a body is still
+        float timeToSleep = 0.5f; // Stillness needed before sleeping
+    };
+
+    // Groups dynamic rigid bodies into islands of touching bodies and puts
+    // an island to sleep once all of its bodies have been still for a
+    // while. Sleeping bodies are skipped by integration, the broadphase,
+    // the narrowphase, the contact solver and mesh transforms. An island
+    // wakes as a whole when an awake body touches it or when one of its
+    // bodies is woken, e.g. by applyForce.
+    //
+    // Must be registered after the narrowphase system it reads from and
+    // before the contact solver, so a woken island is solved the same step.
+    class IslandSystem: public omelette::ecs::System {
+      private:
+        const NarrowphaseSystem& narrowphase;
+
+        SleepSettings settings;
+
+        omelette::physics::IslandBuilder islands;
+
+        // Dynamic bodies of the current update
+        std::vector<omelette::ecs::components::RigidBodyComponent*> bodies;
+
+        // Index of every dynamic body, by entity index
+        std::vector<uint32_t> bodyIndices;
+
+        size_t sleepingCount = 0;
+
+      public:
+        explicit IslandSystem(
+            const NarrowphaseSystem& narrowphase,
+            const SleepSettings& settings = {}
+        );
+
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Build the islands, then wake or put them to sleep
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+
+        // Getters and setters
+        const SleepSettings& getSettings() const;
+        void setSettings(const SleepSettings& settings);
+        size_t getIslandCount() const;
+        size_t getSleepingCount() const;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_ISLANDSYSTEM_HPP
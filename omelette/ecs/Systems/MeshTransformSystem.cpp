@@ -0,0 +1,51 @@
+#include "MeshTransformSystem.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../../utils/Profiler.hpp"
+#include "../Components/MeshComponent.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::MeshComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+
+    /* Get Access
+    - Returns: Read access to rigid bodies and write access to meshes. */
+    omelette::ecs::ComponentAccess MeshTransformSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess()
+            .read<RigidBodyComponent>()
+            .write<MeshComponent>();
+    }
+
+    /* Update
+    - Sets the world transform of each awake rigid body's mesh to the
+      body's position. Only the transform is stored; vertices are moved
+      when someone reads them. A sleeping body has not moved, so its mesh
+      is left alone.
+    - Parameters:
+        - ecs: The ECS holding the bodies and meshes.
+        - deltaTime: Unused.
+        - threadPool: The pool to run chunks on. */
+    void MeshTransformSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("MeshTransformSystem::update");
+        ecs.view<const RigidBodyComponent, MeshComponent>().parallelEach(
+            threadPool,
+            [](const RigidBodyComponent& body, MeshComponent& mesh) {
+                if (body.sleeping) {
+                    return;
+                }
+                mesh.setTransform(glm::translate(
+                    glm::mat4(1.0f),
+                    glm::vec3(body.position.x, body.position.y, body.position.z)
+                ));
+            },
+            64
+        );
+    }
+}; // namespace omelette::ecs::systems
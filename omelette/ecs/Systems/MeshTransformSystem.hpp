@@ -0,0 +1,22 @@
+#ifndef OMELETTE_ECS_SYSTEMS_MESHTRANSFORMSYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_MESHTRANSFORMSYSTEM_HPP
+
+#include "../System.hpp"
+
+namespace omelette::ecs::systems {
+    // Moves the mesh of every entity with a rigid body to the body's position
+    class MeshTransformSystem: public omelette::ecs::System {
+      public:
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Transform every rigid body's mesh, in parallel chunks
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_MESHTRANSFORMSYSTEM_HPP
@@ -0,0 +1,118 @@
+#include "NarrowphaseSystem.hpp"
+
+#include "../../utils/Profiler.hpp"
+#include "../Components/ColliderComponent.hpp"
+#include "../Components/RigidBodyComponent.hpp"
+#include "../ECS.hpp"
+
+namespace omelette::ecs::systems {
+    using omelette::ecs::components::ColliderComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+
+    /* NarrowphaseSystem Constructor
+    - Parameters:
+        - broadphase: The system whose pairs are tested. */
+    NarrowphaseSystem::NarrowphaseSystem(const BroadphaseSystem& broadphase) :
+        broadphase(broadphase) {}
+
+    /* Get Access
+    - Returns: Read access to colliders, rigid bodies and the broadphase
+      pairs, and write access to the contacts. */
+    omelette::ecs::ComponentAccess NarrowphaseSystem::getAccess() const {
+        return omelette::ecs::ComponentAccess()
+            .read<ColliderComponent, RigidBodyComponent>()
+            .readResource<omelette::physics::BroadphasePair>()
+            .writeResource<omelette::physics::ContactPair>();
+    }
+
+    /* Update
+    - Tests each broadphase pair whose entities both have a collider and a
+      rigid body. Per-pair caches are looked up serially, the tests run in
+      parallel, and caches of pairs the broadphase dropped are discarded.
+      A pair whose bodies are both sleeping or static cannot have changed,
+      so its last result is reported again without a test.
+    - Parameters:
+        - ecs: The ECS holding the colliders and bodies.
+        - deltaTime: Unused.
+        - threadPool: The pool to run tests on. */
+    void NarrowphaseSystem::update(
+        omelette::ecs::ECS& ecs,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool
+    ) {
+        OMELETTE_PROFILE_ZONE("NarrowphaseSystem::update");
+        frame++;
+        const auto& pairs = broadphase.getPairs();
+
+        // Sized up front so inserting does not move the cached pairs the
+        // jobs point to
+        caches.reserve(caches.size() + pairs.size());
+        jobs.clear();
+        jobs.reserve(pairs.size());
+        for (const auto& pair : pairs) {
+            auto& cached = caches[pair];
+            cached.frame = frame;
+            jobs.push_back({pair, &cached});
+        }
+
+        const omelette::ecs::ECS& world = ecs;
+        threadPool.parallelFor(jobs.size(), 64, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Job& job = jobs[i];
+                CachedPair& cached = *job.cached;
+                const auto* colliderA =
+                    world.getComponent<ColliderComponent>(job.pair.a);
+                const auto* colliderB =
+                    world.getComponent<ColliderComponent>(job.pair.b);
+                const auto* bodyA =
+                    world.getComponent<RigidBodyComponent>(job.pair.a);
+                const auto* bodyB =
+                    world.getComponent<RigidBodyComponent>(job.pair.b);
+                if (!colliderA || !colliderB || !bodyA || !bodyB) {
+                    cached.hit = false;
+                    continue;
+                }
+
+                auto resting = [](const RigidBodyComponent* body) {
+                    return body->sleeping || body->mass <= 0.0f;
+                };
+                if (cached.tested && resting(bodyA) && resting(bodyB)) {
+                    continue;
+                }
+
+                cached.tested = true;
+                cached.hit = omelette::physics::Narrowphase::collide(
+                    colliderA->shape,
+                    bodyA->position,
+                    colliderB->shape,
+                    bodyB->position,
+                    cached.contact,
+                    &cached.cache
+                );
+            }
+        });
+
+        contacts.clear();
+        for (const auto& job : jobs) {
+            if (job.cached->hit) {
+                contacts.push_back(
+                    {job.pair.a, job.pair.b, job.cached->contact}
+                );
+            }
+        }
+        OMELETTE_PROFILE_COUNTER("narrowphase tests", jobs.size());
+        OMELETTE_PROFILE_COUNTER("contacts", contacts.size());
+
+        // Drop the caches of pairs the broadphase no longer reports
+        caches.eraseIf([this](const auto&, const CachedPair& cached) {
+            return cached.frame != frame;
+        });
+    }
+
+    /* Get Contacts
+    - Returns: The contacts from the last update, sorted by pair. */
+    const std::vector<omelette::physics::ContactPair>&
+    NarrowphaseSystem::getContacts() const {
+        return contacts;
+    }
+}; // namespace omelette::ecs::systems
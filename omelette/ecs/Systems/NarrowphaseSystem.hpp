@@ -0,0 +1,68 @@
+#ifndef OMELETTE_ECS_SYSTEMS_NARROWPHASESYSTEM_HPP
+#define OMELETTE_ECS_SYSTEMS_NARROWPHASESYSTEM_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../../physics/Narrowphase.hpp"
+#include "../../utils/FlatHashMap.hpp"
+#include "../System.hpp"
+#include "BroadphaseSystem.hpp"
+
+namespace omelette::ecs::systems {
+    // Runs exact collision tests on the broadphase pairs of entities that
+    // have a collider and a rigid body. Pairs where neither body can move
+    // (both sleeping or static) keep their last result without a test.
+    // Must be registered after the broadphase system it reads from.
+    class NarrowphaseSystem: public omelette::ecs::System {
+      private:
+        struct CachedPair {
+            omelette::physics::NarrowphaseCache cache;
+            uint32_t frame; // Last frame the pair was reported
+
+            // Last test result, reused while neither body can move
+            omelette::physics::Contact contact;
+            bool tested = false;
+            bool hit = false;
+        };
+
+        // One pair test, run in parallel
+        struct Job {
+            omelette::physics::BroadphasePair pair;
+            CachedPair* cached;
+        };
+
+        const BroadphaseSystem& broadphase;
+
+        // Warm-start state of every pair still reported by the broadphase
+        omelette::utils::FlatHashMap<
+            omelette::physics::BroadphasePair,
+            CachedPair>
+            caches;
+
+        std::vector<Job> jobs;
+
+        // Contacts from the last update, in broadphase pair order
+        std::vector<omelette::physics::ContactPair> contacts;
+
+        uint32_t frame = 0;
+
+      public:
+        explicit NarrowphaseSystem(const BroadphaseSystem& broadphase);
+
+        // Component types the system reads and writes
+        omelette::ecs::ComponentAccess getAccess() const override;
+
+        // Test every broadphase pair, in parallel chunks
+        void update(
+            omelette::ecs::ECS& ecs,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool
+        ) override;
+
+        // Get the contacts from the last update
+        const std::vector<omelette::physics::ContactPair>& getContacts() const;
+    };
+}; // namespace omelette::ecs::systems
+
+#endif // OMELETTE_ECS_SYSTEMS_NARROWPHASESYSTEM_HPP
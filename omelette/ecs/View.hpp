@@ -0,0 +1,283 @@
+#ifndef OMELETTE_ECS_VIEW_HPP
+#define OMELETTE_ECS_VIEW_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../utils/ThreadPool.hpp"
+#include "Archetype.hpp"
+#include "Entity.hpp"
+
+namespace omelette::ecs {
+    // Lightweight, non-owning view over every entity that has all of the
+    // component types Ts. Only the archetypes matching the query are
+    // visited, so iteration costs O(matches). A const component type gives
+    // read-only access to that component.
+    //
+    // Views are invalidated by structural changes (adding or destroying
+    // entities or components) made while iterating.
+    template<typename... Ts>
+    class View {
+        static_assert(sizeof...(Ts) > 0, "A view needs at least one component");
+
+      private:
+        // Archetypes storing every component of the view
+        const std::vector<omelette::ecs::Archetype*>* archetypes;
+
+        // Pointer to the first component of type T in an archetype
+        template<typename T>
+        static T* columnData(omelette::ecs::Archetype& archetype) {
+            return archetype.getComponents<std::remove_const_t<T>>()->data();
+        }
+
+      public:
+        // One matching entity with references to its components
+        using value_type = std::tuple<omelette::ecs::Entity, Ts&...>;
+
+        class Iterator {
+          private:
+            const std::vector<omelette::ecs::Archetype*>* archetypes;
+            size_t archetypeIndex;
+            size_t row;
+            size_t rowCount;
+            const omelette::ecs::Entity* entities;
+            std::tuple<Ts*...> columns;
+
+            // Skip to the next non-empty archetype and cache its columns
+            void seek() {
+                while (archetypeIndex < archetypes->size()) {
+                    auto& archetype = *(*archetypes)[archetypeIndex];
+                    rowCount = archetype.size();
+                    if (rowCount > 0) {
+                        entities = archetype.getEntities().data();
+                        columns = std::tuple<Ts*...>(
+                            columnData<Ts>(archetype)...
+                        );
+                        return;
+                    }
+                    archetypeIndex++;
+                }
+                row = 0;
+                rowCount = 0;
+            }
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = View::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = View::value_type;
+
+            Iterator(
+                const std::vector<omelette::ecs::Archetype*>* archetypes,
+                size_t archetypeIndex
+            ) :
+                archetypes(archetypes),
+                archetypeIndex(archetypeIndex),
+                row(0),
+                rowCount(0),
+                entities(nullptr) {
+                seek();
+            }
+
+            reference operator*() const {
+                return std::apply(
+                    [this](Ts*... data) {
+                        return value_type(entities[row], data[row]...);
+                    },
+                    columns
+                );
+            }
+
+            Iterator& operator++() {
+                if (++row == rowCount) {
+                    row = 0;
+                    archetypeIndex++;
+                    seek();
+                }
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return archetypeIndex == other.archetypeIndex
+                    && row == other.row;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+        };
+
+        explicit View(const std::vector<omelette::ecs::Archetype*>& archetypes) :
+            archetypes(&archetypes) {}
+
+        Iterator begin() const {
+            return Iterator(archetypes, 0);
+        }
+
+        Iterator end() const {
+            return Iterator(archetypes, archetypes->size());
+        }
+
+        // Get the archetypes visited by the view
+        const std::vector<omelette::ecs::Archetype*>& getArchetypes() const {
+            return *archetypes;
+        }
+
+        // Number of matching entities
+        size_t size() const {
+            size_t count = 0;
+            for (const auto* archetype : *archetypes) {
+                count += archetype->size();
+            }
+            return count;
+        }
+
+        // Whether no entity matches
+        bool empty() const {
+            for (const auto* archetype : *archetypes) {
+                if (archetype->size() > 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /* Each
+        - Calls a function for every matching entity, walking each archetype's
+          columns linearly. This is the fastest way to iterate a view.
+        - Parameters:
+            - function: Called as function(Ts&...) or
+              function(Entity, Ts&...). */
+        template<typename Function>
+        void each(Function&& function) const {
+            for (auto* archetype : *archetypes) {
+                eachInRange(*archetype, 0, archetype->size(), function);
+            }
+        }
+
+        /* Parallel Each
+        - Calls a function for every matching entity, splitting each
+          archetype's rows into chunks run across a thread pool. The function
+          must only touch the components it is given.
+        - Parameters:
+            - threadPool: The pool to run chunks on.
+            - function: Called as function(Ts&...) or
+              function(Entity, Ts&...).
+            - grainSize: The minimum number of rows per chunk. */
+        template<typename Function>
+        void parallelEach(
+            omelette::utils::ThreadPool& threadPool,
+            Function&& function,
+            size_t grainSize = 1024
+        ) const {
+            for (auto* archetype : *archetypes) {
+                threadPool.parallelFor(
+                    archetype->size(),
+                    grainSize,
+                    [&](size_t begin, size_t end) {
+                        eachInRange(*archetype, begin, end, function);
+                    }
+                );
+            }
+        }
+
+        /* Each Chunk
+        - Calls a function once per contiguous run of matching rows, with
+          pointers to the start of each component column. Suited to batched
+          (SIMD) kernels.
+        - Parameters:
+            - function: Called as function(count, entities, Ts*...). */
+        template<typename Function>
+        void eachChunk(Function&& function) const {
+            for (auto* archetype : *archetypes) {
+                chunkInRange(*archetype, 0, archetype->size(), function);
+            }
+        }
+
+        /* Parallel Each Chunk
+        - Like eachChunk, but splits each archetype's rows into chunks run
+          across a thread pool.
+        - Parameters:
+            - threadPool: The pool to run chunks on.
+            - function: Called as function(count, entities, Ts*...).
+            - grainSize: The minimum number of rows per chunk. */
+        template<typename Function>
+        void parallelEachChunk(
+            omelette::utils::ThreadPool& threadPool,
+            Function&& function,
+            size_t grainSize = 1024
+        ) const {
+            for (auto* archetype : *archetypes) {
+                threadPool.parallelFor(
+                    archetype->size(),
+                    grainSize,
+                    [&](size_t begin, size_t end) {
+                        chunkInRange(*archetype, begin, end, function);
+                    }
+                );
+            }
+        }
+
+      private:
+        // Call a function once for rows [begin, end) of one archetype
+        template<typename Function>
+        static void chunkInRange(
+            omelette::ecs::Archetype& archetype,
+            size_t begin,
+            size_t end,
+            Function& function
+        ) {
+            if (begin == end) {
+                return;
+            }
+            function(
+                end - begin,
+                archetype.getEntities().data() + begin,
+                (columnData<Ts>(archetype) + begin)...
+            );
+        }
+
+        // Call a function for rows [begin, end) of one archetype
+        template<typename Function>
+        static void eachInRange(
+            omelette::ecs::Archetype& archetype,
+            size_t begin,
+            size_t end,
+            Function& function
+        ) {
+            if (begin == end) {
+                return;
+            }
+
+            const auto* entities = archetype.getEntities().data();
+            std::tuple<Ts*...> columns(columnData<Ts>(archetype)...);
+            std::apply(
+                [&](Ts*... data) {
+                    for (size_t row = begin; row < end; row++) {
+                        if constexpr (std::is_invocable_v<
+                                          Function,
+                                          omelette::ecs::Entity,
+                                          Ts&...>) {
+                            function(entities[row], data[row]...);
+                        } else {
+                            function(data[row]...);
+                        }
+                    }
+                },
+                columns
+            );
+        }
+    };
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_VIEW_HPP
@@ -0,0 +1,151 @@
+#include "World.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "../utils/Profiler.hpp"
+#include "Components/RigidBodyComponent.hpp"
+
+namespace omelette::ecs {
+    using omelette::ecs::components::RigidBodyComponent;
+
+    /* Validate Settings
+    - Throws std::invalid_argument unless the timestep is positive and
+      finite, which the accumulator loop relies on, and at least one
+      substep is allowed; with none, step() would never simulate and would
+      drop all time instead. */
+    static void validateSettings(const StepSettings& settings) {
+        if (!std::isfinite(settings.fixedDeltaTime)
+            || settings.fixedDeltaTime <= 0.0f) {
+            throw std::invalid_argument(
+                "World: fixedDeltaTime must be positive and finite"
+            );
+        }
+        if (settings.maxSubsteps == 0) {
+            throw std::invalid_argument("World: maxSubsteps must be positive");
+        }
+    }
+
+    /* World Constructor
+    - Parameters:
+        - settings: The fixed timestep and substep limit.
+        - threadCount: Threads for the scheduler; zero uses every hardware
+          thread. */
+    World::World(const StepSettings& settings, size_t threadCount) :
+        scheduler(threadCount),
+        settings(settings) {
+        validateSettings(settings);
+    }
+
+    /* Store Previous Positions
+    - Copies each awake rigid body's position to previousPosition, so the
+      state before and after the coming step can be blended. A sleeping
+      body has not moved since the step it fell asleep in, so its
+      previousPosition already equals its position. Runs in parallel on
+      the scheduler's pool. */
+    void World::storePreviousPositions() {
+        OMELETTE_PROFILE_ZONE("World::storePreviousPositions");
+        ecs.view<RigidBodyComponent>().parallelEach(
+            scheduler.getThreadPool(),
+            [](RigidBodyComponent& body) {
+                if (!body.sleeping) {
+                    body.previousPosition = body.position;
+                }
+            },
+            4096
+        );
+    }
+
+    /* Step
+    - Adds the elapsed time to the accumulator and runs one fixed step for
+      every whole timestep in it, up to maxSubsteps. Whole steps left over
+      after the limit are dropped; the remainder stays banked for the next
+      call and sets the interpolation alpha.
+    - Parameters:
+        - elapsedSeconds: Wall-clock time since the last call. Negative or
+          non-finite values are ignored.
+    - Returns: The number of fixed steps run. */
+    unsigned int World::step(double elapsedSeconds) {
+        OMELETTE_PROFILE_ZONE("World::step");
+        if (std::isfinite(elapsedSeconds) && elapsedSeconds > 0.0) {
+            accumulator += elapsedSeconds;
+        }
+
+        const double fixedDeltaTime = settings.fixedDeltaTime;
+        unsigned int steps = 0;
+        while (accumulator >= fixedDeltaTime && steps < settings.maxSubsteps) {
+            stepOnce();
+            accumulator -= fixedDeltaTime;
+            steps++;
+        }
+
+        if (accumulator >= fixedDeltaTime) {
+            const double dropped =
+                std::floor(accumulator / fixedDeltaTime) * fixedDeltaTime;
+            droppedTime += dropped;
+            accumulator -= dropped;
+        }
+        return steps;
+    }
+
+    /* Step Once
+    - Runs every system once with the fixed timestep. */
+    void World::stepOnce() {
+        OMELETTE_PROFILE_ZONE("World::stepOnce");
+        storePreviousPositions();
+        scheduler.run(ecs, settings.fixedDeltaTime);
+        stepCount++;
+    }
+
+    /* Get Alpha
+    - Returns: How far presentation time is between the last two simulated
+      states: 0 at the previous state, approaching 1 at the current one. */
+    float World::getAlpha() const {
+        return static_cast<float>(accumulator / settings.fixedDeltaTime);
+    }
+
+    /* Get ECS
+    - Returns: The world's entities and components. */
+    omelette::ecs::ECS& World::getECS() {
+        return ecs;
+    }
+
+    /* Get Scheduler
+    - Returns: The scheduler running the world's systems. */
+    omelette::ecs::Scheduler& World::getScheduler() {
+        return scheduler;
+    }
+
+    /* Get Settings
+    - Returns: The fixed timestep and substep limit. */
+    const StepSettings& World::getSettings() const {
+        return settings;
+    }
+
+    /* Get Step Count
+    - Returns: The number of fixed steps run so far. */
+    uint64_t World::getStepCount() const {
+        return stepCount;
+    }
+
+    /* Get Dropped Time
+    - Returns: The total time the substep limit has discarded, in seconds.
+      Non-zero means the simulation could not keep up with real time. */
+    double World::getDroppedTime() const {
+        return droppedTime;
+    }
+
+    /* Set Settings
+    - Replaces the timestep settings. Banked time carries over, less whole
+      new steps, so a shorter timestep does not cause a burst of steps.
+    - Parameters:
+        - newSettings: The new settings. */
+    void World::setSettings(const StepSettings& newSettings) {
+        validateSettings(newSettings);
+        settings = newSettings;
+        const double remainder =
+            std::fmod(accumulator, double(settings.fixedDeltaTime));
+        droppedTime += accumulator - remainder;
+        accumulator = remainder;
+    }
+}; // namespace omelette::ecs
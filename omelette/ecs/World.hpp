@@ -0,0 +1,66 @@
+#ifndef OMELETTE_ECS_WORLD_HPP
+#define OMELETTE_ECS_WORLD_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ECS.hpp"
+#include "Scheduler.hpp"
+
+namespace omelette::ecs {
+    // Fixed-timestep settings of a World
+    struct StepSettings {
+        float fixedDeltaTime = 1.0f / 60.0f; // Simulated time per step
+        unsigned int maxSubsteps = 8; // Most steps run by one step(); >= 1
+    };
+
+    // Entities and systems driven at a fixed timestep. step() takes the
+    // wall-clock time since the last call, banks it in an accumulator and
+    // runs as many fixed steps as fit, so the simulation advances at the
+    // same rate and cost whatever the frame rate. Time the substep limit
+    // leaves unsimulated is dropped, so a slow frame cannot snowball into
+    // ever longer ones; the simulation then runs slower than real time.
+    class World {
+      private:
+        omelette::ecs::ECS ecs;
+        omelette::ecs::Scheduler scheduler;
+        StepSettings settings;
+
+        double accumulator = 0.0; // Wall-clock time not yet simulated
+        double droppedTime = 0.0; // Time discarded by the substep limit
+        uint64_t stepCount = 0; // Fixed steps run so far
+
+        // Record every awake rigid body's position before a step
+        void storePreviousPositions();
+
+      public:
+        // Create a world; zero threads uses every hardware thread
+        explicit World(
+            const StepSettings& settings = StepSettings(),
+            size_t threadCount = 0
+        );
+
+        // Advance by elapsed seconds of wall-clock time and return the
+        // number of fixed steps run
+        unsigned int step(double elapsedSeconds);
+
+        // Run exactly one fixed step, bypassing the accumulator
+        void stepOnce();
+
+        // Fraction of a step banked in the accumulator, in [0, 1), for
+        // blending the last two simulated states when presenting
+        float getAlpha() const;
+
+        // Getters
+        omelette::ecs::ECS& getECS();
+        omelette::ecs::Scheduler& getScheduler();
+        const StepSettings& getSettings() const;
+        uint64_t getStepCount() const;
+        double getDroppedTime() const;
+
+        // Change the timestep; banked time is kept
+        void setSettings(const StepSettings& newSettings);
+    };
+}; // namespace omelette::ecs
+
+#endif // OMELETTE_ECS_WORLD_HPP
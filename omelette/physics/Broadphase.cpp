@@ -0,0 +1,36 @@
+#include "Broadphase.hpp"
+
+#include "DynamicAABBTree.hpp"
+#include "SweepAndPrune.hpp"
+
+namespace omelette::physics {
+    /* Fatten
+    - Grows a tight AABB by the margin and towards its predicted motion.
+    - Parameters:
+        - aabb: The tight AABB.
+        - displacement: The expected motion until the next update.
+    - Returns: The fat AABB. */
+    utils::AABB Broadphase::fatten(
+        const utils::AABB& aabb,
+        const utils::Vec3& displacement
+    ) const {
+        return aabb.expanded(margin).extended(displacement);
+    }
+
+    /* Create Broadphase
+    - Creates a broadphase implementation chosen at runtime.
+    - Parameters:
+        - type: The implementation to create.
+        - margin: The fat AABB margin.
+    - Returns: The new broadphase. */
+    std::unique_ptr<Broadphase>
+    createBroadphase(BroadphaseType type, float margin) {
+        switch (type) {
+            case BroadphaseType::SweepAndPrune:
+                return std::make_unique<SweepAndPrune>(margin);
+            case BroadphaseType::DynamicTree:
+            default:
+                return std::make_unique<DynamicAABBTree>(margin);
+        }
+    }
+}; // namespace omelette::physics
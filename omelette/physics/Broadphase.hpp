@@ -0,0 +1,100 @@
+#ifndef OMELETTE_PHYSICS_BROADPHASE_HPP
+#define OMELETTE_PHYSICS_BROADPHASE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "../ecs/Entity.hpp"
+#include "../utils/AABB.hpp"
+#include "../utils/Vec3.hpp"
+
+namespace omelette::physics {
+    // Handle of a proxy registered with a broadphase
+    using ProxyId = int32_t;
+
+    // Potentially colliding entities, ordered so that a < b
+    struct BroadphasePair {
+        omelette::ecs::Entity a;
+        omelette::ecs::Entity b;
+
+        bool operator==(const BroadphasePair& other) const {
+            return a == other.a && b == other.b;
+        }
+
+        bool operator<(const BroadphasePair& other) const {
+            return a < other.a || (a == other.a && b < other.b);
+        }
+    };
+
+    // Available broadphase implementations
+    enum class BroadphaseType { DynamicTree, SweepAndPrune };
+
+    // Finds pairs of entities whose fattened bounding boxes overlap. Each
+    // proxy stores a fat AABB: the tight box grown by a margin. A proxy is
+    // only updated when its tight box escapes the fat one, so small motions
+    // cost nothing.
+    class Broadphase {
+      protected:
+        float margin; // Distance the fat AABB extends past the tight one
+
+        // Fat AABB for a tight AABB moving by a displacement
+        utils::AABB
+        fatten(const utils::AABB& aabb, const utils::Vec3& displacement) const;
+
+      public:
+        explicit Broadphase(float margin) : margin(margin) {}
+
+        // Virtual destructor for polymorphic deletion
+        virtual ~Broadphase() = default;
+
+        // Register an entity's tight AABB
+        virtual ProxyId
+        createProxy(const utils::AABB& aabb, omelette::ecs::Entity entity) = 0;
+
+        // Unregister a proxy
+        virtual void destroyProxy(ProxyId proxy) = 0;
+
+        // Update a proxy's tight AABB; displacement predicts the next motion.
+        // Returns true if the fat AABB had to be rebuilt.
+        virtual bool moveProxy(
+            ProxyId proxy,
+            const utils::AABB& aabb,
+            const utils::Vec3& displacement
+        ) = 0;
+
+        // Get the fat AABB of a proxy
+        virtual const utils::AABB& getFatAABB(ProxyId proxy) const = 0;
+
+        // Number of registered proxies
+        virtual size_t getProxyCount() const = 0;
+
+        // Replace pairs with every overlapping pair, sorted and unique
+        virtual void computePairs(std::vector<BroadphasePair>& pairs) = 0;
+
+        // Get the fat AABB margin
+        float getMargin() const {
+            return margin;
+        }
+    };
+
+    // Create a broadphase of the given type
+    std::unique_ptr<Broadphase>
+    createBroadphase(BroadphaseType type, float margin = 0.1f);
+}; // namespace omelette::physics
+
+namespace std {
+    // Hash pairs by their packed entity ids
+    template<>
+    struct hash<omelette::physics::BroadphasePair> {
+        size_t operator()(const omelette::physics::BroadphasePair& pair
+        ) const noexcept {
+            return hash<uint64_t>()(
+                (static_cast<uint64_t>(pair.a.id) << 32) | pair.b.id
+            );
+        }
+    };
+}; // namespace std
+
+#endif // OMELETTE_PHYSICS_BROADPHASE_HPP
@@ -0,0 +1,128 @@
+#include "ContactManifold.hpp"
+
+#include <algorithm>
+
+namespace omelette::physics {
+    /* Refresh
+    - Moves every point with its bodies and recomputes its depth. Points
+      that separated by more than BREAK_DISTANCE, or whose anchors slid
+      apart by more than BREAK_DISTANCE, are dropped.
+    - Parameters:
+        - positionA: Current position of body A.
+        - positionB: Current position of body B. */
+    void ContactManifold::refresh(
+        const utils::Vec3& positionA,
+        const utils::Vec3& positionB
+    ) {
+        for (int i = pointCount - 1; i >= 0; i--) {
+            ManifoldPoint& point = points[i];
+            const utils::Vec3 offset =
+                (positionA + point.localA) - (positionB + point.localB);
+            point.depth = offset.dot(point.normal);
+
+            const utils::Vec3 drift = offset - point.normal * point.depth;
+            if (point.depth < -BREAK_DISTANCE
+                || drift.dot(drift) > BREAK_DISTANCE * BREAK_DISTANCE) {
+                removePoint(i);
+            }
+        }
+    }
+
+    /* Add Contact
+    - Adds a contact, replacing a point within MATCH_DISTANCE of it (and
+      inheriting that point's impulses) or, if the manifold is full, the
+      point whose loss shrinks the contact patch the least.
+    - Parameters:
+        - contact: The narrowphase contact, in world space.
+        - positionA: Current position of body A.
+        - positionB: Current position of body B. */
+    void ContactManifold::addContact(
+        const Contact& contact,
+        const utils::Vec3& positionA,
+        const utils::Vec3& positionB
+    ) {
+        ManifoldPoint point;
+        point.localA = contact.pointA - positionA;
+        point.localB = contact.pointB - positionB;
+        point.normal = contact.normal;
+        point.depth = contact.depth;
+
+        int match = -1;
+        float matchDistance = MATCH_DISTANCE * MATCH_DISTANCE;
+        for (int i = 0; i < pointCount; i++) {
+            const utils::Vec3 offset = points[i].localA - point.localA;
+            const float distance = offset.dot(offset);
+            if (distance < matchDistance) {
+                matchDistance = distance;
+                match = i;
+            }
+        }
+
+        if (match >= 0) {
+            point.normalImpulse = points[match].normalImpulse;
+            point.tangentImpulse[0] = points[match].tangentImpulse[0];
+            point.tangentImpulse[1] = points[match].tangentImpulse[1];
+        } else if (pointCount < MAX_POINTS) {
+            match = pointCount++;
+        } else {
+            match = chooseReplacement(point);
+        }
+        points[match] = point;
+    }
+
+    /* Choose Replacement
+    - Picks the point to replace with a new one in a full manifold. The
+      deepest point is always kept; of the rest, the one whose removal
+      leaves the largest quadrilateral is replaced.
+    - Parameters:
+        - point: The new point.
+    - Returns: The index of the point to replace. */
+    int ContactManifold::chooseReplacement(const ManifoldPoint& point) const {
+        int deepest = -1;
+        float maxDepth = point.depth;
+        for (int i = 0; i < pointCount; i++) {
+            if (points[i].depth > maxDepth) {
+                maxDepth = points[i].depth;
+                deepest = i;
+            }
+        }
+
+        int best = 0;
+        float bestArea = -1.0f;
+        for (int i = 0; i < pointCount; i++) {
+            if (i == deepest) {
+                continue;
+            }
+
+            // Corners left if point i is replaced
+            utils::Vec3 corners[MAX_POINTS];
+            for (int j = 0; j < pointCount; j++) {
+                corners[j] = j == i ? point.localA : points[j].localA;
+            }
+
+            // Squared area of the quadrilateral, whichever way its
+            // corners are ordered
+            const utils::Vec3 areas[3] = {
+                (corners[0] - corners[1]).cross(corners[2] - corners[3]),
+                (corners[0] - corners[2]).cross(corners[1] - corners[3]),
+                (corners[0] - corners[3]).cross(corners[1] - corners[2])
+            };
+            float area = 0.0f;
+            for (const auto& cross : areas) {
+                area = std::max(area, cross.dot(cross));
+            }
+            if (area > bestArea) {
+                bestArea = area;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    /* Remove Point
+    - Removes a point by moving the last point into its slot. */
+    void ContactManifold::removePoint(int index) {
+        points[index] = points[pointCount - 1];
+        pointCount--;
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,60 @@
+#ifndef OMELETTE_PHYSICS_CONTACTMANIFOLD_HPP
+#define OMELETTE_PHYSICS_CONTACTMANIFOLD_HPP
+
+#include "../utils/Vec3.hpp"
+#include "Narrowphase.hpp"
+
+namespace omelette::physics {
+    // Contact point kept across frames, anchored to both bodies
+    struct ManifoldPoint {
+        utils::Vec3 localA; // Point on A, relative to A's position
+        utils::Vec3 localB; // Point on B, relative to B's position
+        utils::Vec3 normal; // Unit direction from A towards B
+        float depth = 0.0f; // Penetration along the normal
+
+        // Impulses accumulated by the solver, reused to warm-start it
+        float normalImpulse = 0.0f;
+        float tangentImpulse[2] = {0.0f, 0.0f};
+    };
+
+    // Up to four contact points between one pair of bodies. The
+    // narrowphase reports one point per frame; the manifold keeps earlier
+    // points while the bodies stay in contact, so the solver sees a stable
+    // contact patch and can warm-start from last frame's impulses.
+    class ContactManifold {
+      public:
+        static constexpr int MAX_POINTS = 4;
+
+        // Points closer than this are treated as the same contact
+        static constexpr float MATCH_DISTANCE = 0.02f;
+
+        // Points that separate or slide further than this are dropped
+        static constexpr float BREAK_DISTANCE = 0.02f;
+
+        ManifoldPoint points[MAX_POINTS];
+        int pointCount = 0;
+
+        // Recompute each point's depth from the current body positions and
+        // drop points that separated or slid apart
+        void refresh(
+            const utils::Vec3& positionA,
+            const utils::Vec3& positionB
+        );
+
+        // Merge a new narrowphase contact, keeping the impulses of the
+        // point it replaces
+        void addContact(
+            const Contact& contact,
+            const utils::Vec3& positionA,
+            const utils::Vec3& positionB
+        );
+
+      private:
+        // Index of the point to replace when the manifold is full
+        int chooseReplacement(const ManifoldPoint& point) const;
+
+        void removePoint(int index);
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_CONTACTMANIFOLD_HPP
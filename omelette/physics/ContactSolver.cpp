@@ -0,0 +1,369 @@
+#include "ContactSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace omelette::physics {
+    namespace {
+        // Closing speeds below this do not bounce
+        constexpr float RESTITUTION_THRESHOLD = 1.0f;
+
+        // Constraints per parallel chunk within a batch
+        constexpr size_t GRAIN_SIZE = 64;
+
+        // Two unit tangents perpendicular to a unit normal, derived from
+        // the normal alone so they are stable from frame to frame
+        void computeTangents(
+            const utils::Vec3& normal,
+            utils::Vec3* tangents
+        ) {
+            if (std::fabs(normal.x) >= 0.57735f) {
+                tangents[0] =
+                    utils::Vec3(normal.y, -normal.x, 0.0f).normalize();
+            } else {
+                tangents[0] =
+                    utils::Vec3(0.0f, normal.z, -normal.y).normalize();
+            }
+            tangents[1] = normal.cross(tangents[0]);
+        }
+
+        // Apply an impulse to two bodies, leaving static bodies untouched
+        void applyImpulse(
+            ContactSolver::Body& bodyA,
+            ContactSolver::Body& bodyB,
+            const utils::Vec3& impulse,
+            utils::Vec3 ContactSolver::Body::*velocity =
+                &ContactSolver::Body::velocity
+        ) {
+            if (bodyA.inverseMass > 0.0f) {
+                bodyA.*velocity -= impulse * bodyA.inverseMass;
+            }
+            if (bodyB.inverseMass > 0.0f) {
+                bodyB.*velocity += impulse * bodyB.inverseMass;
+            }
+        }
+    } // namespace
+
+    /* ContactSolver Constructor
+    - Parameters:
+        - settings: The solver tuning. */
+    ContactSolver::ContactSolver(const SolverSettings& settings) :
+        settings(settings) {}
+
+    /* Solve
+    - Colors the constraints, warm-starts them from the manifolds'
+      accumulated impulses, runs the velocity iterations and then the
+      penetration iterations. Constraints of one color are solved in
+      parallel chunks.
+    - Parameters:
+        - bodies: Body velocities, updated in place.
+        - constraints: The manifolds to solve; their impulses are updated.
+        - deltaTime: The time step.
+        - threadPool: The pool to run batches on.
+        - scratch: Where temporaries are allocated, e.g. a frame arena. */
+    void ContactSolver::solve(
+        std::vector<Body>& bodies,
+        const std::vector<Constraint>& constraints,
+        float deltaTime,
+        omelette::utils::ThreadPool& threadPool,
+        std::pmr::memory_resource* scratch
+    ) {
+        if (constraints.empty() || deltaTime <= 0.0f) {
+            return;
+        }
+
+        color(bodies, constraints, scratch);
+
+        // Run a function over every constraint, one color at a time
+        auto forEachBatch = [&](auto&& function) {
+            for (size_t batch = 0; batch + 1 < batchOffsets.size(); batch++) {
+                const size_t begin = batchOffsets[batch];
+                const size_t end = batchOffsets[batch + 1];
+
+                // The overflow batch may share bodies: run it serially
+                const bool serial = batch == MAX_COLORS;
+                auto run = [&](size_t first, size_t last) {
+                    for (size_t i = begin + first; i < begin + last; i++) {
+                        function(batchOrder[i]);
+                    }
+                };
+                if (serial) {
+                    run(0, end - begin);
+                } else {
+                    threadPool.parallelFor(end - begin, GRAIN_SIZE, run);
+                }
+            }
+        };
+
+        prepare(bodies, constraints, deltaTime);
+        if (settings.warmStarting) {
+            forEachBatch([&](uint32_t index) {
+                const Constraint& constraint = constraints[index];
+                const ContactManifold& manifold = *constraint.manifold;
+                Body& bodyA = bodies[constraint.bodyA];
+                Body& bodyB = bodies[constraint.bodyB];
+                for (int i = 0; i < manifold.pointCount; i++) {
+                    const ManifoldPoint& point = manifold.points[i];
+                    const PointData& data =
+                        pointData[index * ContactManifold::MAX_POINTS + i];
+                    applyImpulse(
+                        bodyA,
+                        bodyB,
+                        point.normal * point.normalImpulse
+                            + data.tangents[0] * point.tangentImpulse[0]
+                            + data.tangents[1] * point.tangentImpulse[1]
+                    );
+                }
+            });
+        }
+
+        for (int iteration = 0; iteration < settings.iterations; iteration++) {
+            forEachBatch([&](uint32_t index) {
+                solveConstraint(bodies, constraints[index], index);
+            });
+        }
+
+        for (int iteration = 0; iteration < settings.positionIterations;
+             iteration++) {
+            forEachBatch([&](uint32_t index) {
+                solvePenetration(bodies, constraints[index], index);
+            });
+        }
+    }
+
+    /* Color
+    - Greedily assigns each constraint the lowest color not yet used by
+      either of its dynamic bodies, then groups constraints by color.
+      Static bodies are never written, so they may appear in every color.
+      Constraints that find no free color go to a final serial batch.
+    - Parameters:
+        - bodies: The bodies, for their inverse masses.
+        - constraints: The constraints to color.
+        - scratch: Where temporaries are allocated. */
+    void ContactSolver::color(
+        const std::vector<Body>& bodies,
+        const std::vector<Constraint>& constraints,
+        std::pmr::memory_resource* scratch
+    ) {
+        bodyColors.assign(bodies.size(), 0);
+        batchOffsets.assign(MAX_COLORS + 2, 0);
+        std::pmr::vector<uint32_t> colors(constraints.size(), scratch);
+
+        for (size_t i = 0; i < constraints.size(); i++) {
+            const uint32_t bodyA = constraints[i].bodyA;
+            const uint32_t bodyB = constraints[i].bodyB;
+            const bool dynamicA = bodies[bodyA].inverseMass > 0.0f;
+            const bool dynamicB = bodies[bodyB].inverseMass > 0.0f;
+
+            const uint64_t used = (dynamicA ? bodyColors[bodyA] : 0)
+                | (dynamicB ? bodyColors[bodyB] : 0);
+            uint32_t color = MAX_COLORS;
+            for (uint32_t c = 0; c < MAX_COLORS; c++) {
+                if (!(used & (uint64_t(1) << c))) {
+                    color = c;
+                    break;
+                }
+            }
+
+            if (color < MAX_COLORS) {
+                if (dynamicA) {
+                    bodyColors[bodyA] |= uint64_t(1) << color;
+                }
+                if (dynamicB) {
+                    bodyColors[bodyB] |= uint64_t(1) << color;
+                }
+            }
+            colors[i] = color;
+            batchOffsets[color + 1]++;
+        }
+
+        // Counting sort of the constraint indices by color
+        for (size_t c = 1; c < batchOffsets.size(); c++) {
+            batchOffsets[c] += batchOffsets[c - 1];
+        }
+        std::pmr::vector<size_t> cursor(
+            batchOffsets.begin(),
+            batchOffsets.end() - 1,
+            scratch
+        );
+        batchOrder.resize(constraints.size());
+        for (size_t i = 0; i < constraints.size(); i++) {
+            batchOrder[cursor[colors[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    /* Prepare
+    - Computes each point's tangents and targets. The velocity target lets
+      a separated point close its gap within the step but no further, or
+      bounces an impact if restitution asks for more. The penetration
+      target pushes out the penetration beyond the slop. Reads velocities
+      only.
+    - Parameters:
+        - bodies: The bodies, before warm starting.
+        - constraints: The constraints to prepare.
+        - deltaTime: The time step. */
+    void ContactSolver::prepare(
+        const std::vector<Body>& bodies,
+        const std::vector<Constraint>& constraints,
+        float deltaTime
+    ) {
+        pointData.resize(constraints.size() * ContactManifold::MAX_POINTS);
+        const float inverseDeltaTime = 1.0f / deltaTime;
+
+        for (size_t index = 0; index < constraints.size(); index++) {
+            const Constraint& constraint = constraints[index];
+            const ContactManifold& manifold = *constraint.manifold;
+            const utils::Vec3 relativeVelocity =
+                bodies[constraint.bodyB].velocity
+                - bodies[constraint.bodyA].velocity;
+
+            for (int i = 0; i < manifold.pointCount; i++) {
+                const ManifoldPoint& point = manifold.points[i];
+                PointData& data =
+                    pointData[index * ContactManifold::MAX_POINTS + i];
+                computeTangents(point.normal, data.tangents);
+
+                data.bias = std::min(point.depth, 0.0f) * inverseDeltaTime;
+                data.positionBias = settings.baumgarte * inverseDeltaTime
+                    * std::max(point.depth - settings.slop, 0.0f);
+                data.pseudoImpulse = 0.0f;
+
+                const float closingVelocity =
+                    relativeVelocity.dot(point.normal);
+                if (closingVelocity < -RESTITUTION_THRESHOLD) {
+                    data.bias = std::max(
+                        data.bias,
+                        -settings.restitution * closingVelocity
+                    );
+                }
+            }
+        }
+    }
+
+    /* Solve Constraint
+    - Runs one Gauss-Seidel pass over a manifold's points: the normal
+      impulse is clamped to push only, and the friction impulses to the
+      Coulomb cone of the accumulated normal impulse.
+    - Parameters:
+        - bodies: The body velocities.
+        - constraint: The constraint to solve.
+        - constraintIndex: Its index, to find its precomputed data. */
+    void ContactSolver::solveConstraint(
+        std::vector<Body>& bodies,
+        const Constraint& constraint,
+        size_t constraintIndex
+    ) {
+        Body& bodyA = bodies[constraint.bodyA];
+        Body& bodyB = bodies[constraint.bodyB];
+        const float inverseMassSum = bodyA.inverseMass + bodyB.inverseMass;
+        if (inverseMassSum <= 0.0f) {
+            return;
+        }
+        const float effectiveMass = 1.0f / inverseMassSum;
+
+        ContactManifold& manifold = *constraint.manifold;
+        for (int i = 0; i < manifold.pointCount; i++) {
+            ManifoldPoint& point = manifold.points[i];
+            const PointData& data = pointData
+                [constraintIndex * ContactManifold::MAX_POINTS + i];
+
+            // Friction, bounded by the current normal impulse
+            const float maxFriction = settings.friction * point.normalImpulse;
+            for (int t = 0; t < 2; t++) {
+                const utils::Vec3 relativeVelocity =
+                    bodyB.velocity - bodyA.velocity;
+                const float lambda =
+                    -effectiveMass * relativeVelocity.dot(data.tangents[t]);
+                const float previous = point.tangentImpulse[t];
+                point.tangentImpulse[t] =
+                    std::clamp(previous + lambda, -maxFriction, maxFriction);
+                applyImpulse(
+                    bodyA,
+                    bodyB,
+                    data.tangents[t] * (point.tangentImpulse[t] - previous)
+                );
+            }
+
+            // Non-penetration
+            const utils::Vec3 relativeVelocity =
+                bodyB.velocity - bodyA.velocity;
+            const float lambda = effectiveMass
+                * (data.bias - relativeVelocity.dot(point.normal));
+            const float previous = point.normalImpulse;
+            point.normalImpulse = std::max(previous + lambda, 0.0f);
+            applyImpulse(
+                bodyA,
+                bodyB,
+                point.normal * (point.normalImpulse - previous)
+            );
+        }
+    }
+
+    /* Solve Penetration
+    - Runs one pass over a manifold's points on the pseudo-velocities,
+      pushing penetrating bodies apart. The impulses are clamped to push
+      only and are not kept for warm starting.
+    - Parameters:
+        - bodies: The body pseudo-velocities.
+        - constraint: The constraint to solve.
+        - constraintIndex: Its index, to find its precomputed data. */
+    void ContactSolver::solvePenetration(
+        std::vector<Body>& bodies,
+        const Constraint& constraint,
+        size_t constraintIndex
+    ) {
+        Body& bodyA = bodies[constraint.bodyA];
+        Body& bodyB = bodies[constraint.bodyB];
+        const float inverseMassSum = bodyA.inverseMass + bodyB.inverseMass;
+        if (inverseMassSum <= 0.0f) {
+            return;
+        }
+        const float effectiveMass = 1.0f / inverseMassSum;
+
+        const ContactManifold& manifold = *constraint.manifold;
+        for (int i = 0; i < manifold.pointCount; i++) {
+            const utils::Vec3& normal = manifold.points[i].normal;
+            PointData& data = pointData
+                [constraintIndex * ContactManifold::MAX_POINTS + i];
+
+            const utils::Vec3 relativeVelocity =
+                bodyB.pseudoVelocity - bodyA.pseudoVelocity;
+            const float lambda = effectiveMass
+                * (data.positionBias - relativeVelocity.dot(normal));
+            const float previous = data.pseudoImpulse;
+            data.pseudoImpulse = std::max(previous + lambda, 0.0f);
+            applyImpulse(
+                bodyA,
+                bodyB,
+                normal * (data.pseudoImpulse - previous),
+                &Body::pseudoVelocity
+            );
+        }
+    }
+
+    /* Get Settings
+    - Returns: The solver tuning. */
+    const SolverSettings& ContactSolver::getSettings() const {
+        return settings;
+    }
+
+    /* Set Settings
+    - Parameters:
+        - settings: The new solver tuning. */
+    void ContactSolver::setSettings(const SolverSettings& settings) {
+        this->settings = settings;
+    }
+
+    /* Get Batch Order
+    - Returns: Constraint indices grouped by color in the last solve. */
+    const std::vector<uint32_t>& ContactSolver::getBatchOrder() const {
+        return batchOrder;
+    }
+
+    /* Get Batch Offsets
+    - Returns: Where each color starts in the batch order; the last batch
+      holds constraints that found no free color and runs serially. */
+    const std::vector<size_t>& ContactSolver::getBatchOffsets() const {
+        return batchOffsets;
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,135 @@
+#ifndef OMELETTE_PHYSICS_CONTACTSOLVER_HPP
+#define OMELETTE_PHYSICS_CONTACTSOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "../utils/ThreadPool.hpp"
+#include "../utils/Vec3.hpp"
+#include "ContactManifold.hpp"
+
+namespace omelette::physics {
+    // Tuning of the contact solver
+    struct SolverSettings {
+        int iterations = 4; // Velocity iterations per step
+        int positionIterations = 2; // Penetration iterations per step
+        float friction = 0.5f; // Coulomb friction coefficient
+        float restitution = 0.0f; // Bounciness of impacts
+        float baumgarte = 0.2f; // Fraction of penetration fixed per step
+        float slop = 0.005f; // Penetration left uncorrected
+        bool warmStarting = true; // Start from last frame's impulses
+    };
+
+    // Sequential-impulse (projected Gauss-Seidel) solver for contact
+    // manifolds. Each point has a non-penetration constraint and two
+    // Coulomb friction constraints.
+    //
+    // Penetration is corrected with split impulses: a separate pass solves
+    // for a pseudo-velocity that moves the bodies apart this step but adds
+    // no momentum. Folding the correction into the velocity impulses
+    // instead would also feed it into the warm start, which makes tall
+    // stacks jitter at low iteration counts.
+    //
+    // Constraints are greedily graph-colored so that no two constraints in
+    // a color share a dynamic body; each color is then solved in parallel
+    // without locks, and colors run one after another. Accumulated impulses
+    // are stored back in the manifolds to warm-start the next step.
+    //
+    // Bodies have no orientation, so constraints act on linear velocity.
+    class ContactSolver {
+      public:
+        // Velocity state of one body; zero inverse mass is static. The
+        // pseudo-velocity is an output: the position correction, per
+        // second, to apply on top of the integrated velocity.
+        struct Body {
+            utils::Vec3 velocity;
+            float inverseMass;
+            utils::Vec3 pseudoVelocity;
+        };
+
+        // Manifold between two bodies, by index into the body array
+        struct Constraint {
+            uint32_t bodyA;
+            uint32_t bodyB;
+            ContactManifold* manifold;
+        };
+
+        // Colors available before constraints fall into a serial batch
+        static constexpr size_t MAX_COLORS = 64;
+
+        explicit ContactSolver(const SolverSettings& settings = {});
+
+        // Solve the constraints, updating body velocities and the
+        // manifolds' accumulated impulses; temporaries use scratch
+        void solve(
+            std::vector<Body>& bodies,
+            const std::vector<Constraint>& constraints,
+            float deltaTime,
+            omelette::utils::ThreadPool& threadPool,
+            std::pmr::memory_resource* scratch =
+                std::pmr::get_default_resource()
+        );
+
+        // Getters and setters
+        const SolverSettings& getSettings() const;
+        void setSettings(const SolverSettings& settings);
+
+        // Constraint indices of batch i are in
+        // getBatchOrder()[getBatchOffsets()[i]..getBatchOffsets()[i + 1])
+        const std::vector<uint32_t>& getBatchOrder() const;
+        const std::vector<size_t>& getBatchOffsets() const;
+
+      private:
+        // Per-point data precomputed once per step
+        struct PointData {
+            utils::Vec3 tangents[2];
+            float bias; // Target separating velocity
+            float positionBias; // Target separating pseudo-velocity
+            float pseudoImpulse; // Accumulated this step only
+        };
+
+        SolverSettings settings;
+
+        // Constraint indices grouped by color, and where each color starts
+        std::vector<uint32_t> batchOrder;
+        std::vector<size_t> batchOffsets;
+
+        // Colors used by each body's constraints, as a bit set
+        std::vector<uint64_t> bodyColors;
+
+        // Precomputed point data, MAX_POINTS per constraint
+        std::vector<PointData> pointData;
+
+        // Group constraints into batches sharing no dynamic body
+        void color(
+            const std::vector<Body>& bodies,
+            const std::vector<Constraint>& constraints,
+            std::pmr::memory_resource* scratch
+        );
+
+        // Compute each point's tangents and bias
+        void prepare(
+            const std::vector<Body>& bodies,
+            const std::vector<Constraint>& constraints,
+            float deltaTime
+        );
+
+        // Run one iteration over a single constraint
+        void solveConstraint(
+            std::vector<Body>& bodies,
+            const Constraint& constraint,
+            size_t constraintIndex
+        );
+
+        // Run one penetration iteration over a single constraint
+        void solvePenetration(
+            std::vector<Body>& bodies,
+            const Constraint& constraint,
+            size_t constraintIndex
+        );
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_CONTACTSOLVER_HPP
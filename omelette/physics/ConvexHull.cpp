@@ -0,0 +1,221 @@
+#include "ConvexHull.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+namespace omelette::physics {
+    namespace {
+        // Pack a quantized grid cell into a hash key
+        uint64_t cellKey(int64_t x, int64_t y, int64_t z) {
+            const uint64_t mask = (1ull << 21) - 1;
+            return (static_cast<uint64_t>(x) & mask)
+                | ((static_cast<uint64_t>(y) & mask) << 21)
+                | ((static_cast<uint64_t>(z) & mask) << 42);
+        }
+    } // namespace
+
+    /* ConvexHull Constructor
+    - Welds coincident vertices and caches the vertex adjacency of the mesh,
+      its bounds and its mass properties.
+    - Parameters:
+        - vertices: The mesh vertices, which must be in convex position.
+        - indices: Triangle list over the vertices. */
+    ConvexHull::ConvexHull(
+        const std::vector<utils::Vec3>& vertices,
+        const utils::IndexBuffer& indices
+    ) :
+        bounds(utils::AABB::fromPoints(vertices)),
+        massProperties(utils::MassProperties::fromMesh(vertices, indices)) {
+        std::vector<uint32_t> remap;
+        weld(vertices, remap);
+
+        // Collect every triangle edge in both directions
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        edges.reserve(indices.size() * 2);
+        indices.visit([&](const auto& typed) {
+            for (size_t i = 0; i + 2 < typed.size(); i += 3) {
+                const uint32_t triangle[3] = {
+                    remap[typed[i]],
+                    remap[typed[i + 1]],
+                    remap[typed[i + 2]]
+                };
+                for (int edge = 0; edge < 3; edge++) {
+                    const uint32_t a = triangle[edge];
+                    const uint32_t b = triangle[(edge + 1) % 3];
+                    if (a != b) {
+                        edges.emplace_back(a, b);
+                        edges.emplace_back(b, a);
+                    }
+                }
+            }
+        });
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        // Compressed adjacency rows
+        adjacencyOffsets.assign(this->vertices.size() + 1, 0);
+        adjacency.reserve(edges.size());
+        for (const auto& edge : edges) {
+            adjacencyOffsets[edge.first + 1]++;
+            adjacency.push_back(edge.second);
+        }
+        for (size_t i = 1; i < adjacencyOffsets.size(); i++) {
+            adjacencyOffsets[i] += adjacencyOffsets[i - 1];
+        }
+    }
+
+    /* Weld
+    - Merges vertices closer than a tolerance relative to the mesh size,
+      using a hash grid so the pass stays linear.
+    - Parameters:
+        - points: The input vertices.
+        - remap: Filled with the welded index of every input vertex. */
+    void ConvexHull::weld(
+        const std::vector<utils::Vec3>& points,
+        std::vector<uint32_t>& remap
+    ) {
+        remap.resize(points.size());
+        if (points.empty()) {
+            return;
+        }
+
+        float extent = 0.0f;
+        for (const auto& point : points) {
+            extent = std::max(
+                extent,
+                std::max(
+                    std::fabs(point.x),
+                    std::max(std::fabs(point.y), std::fabs(point.z))
+                )
+            );
+        }
+        const float tolerance = std::max(extent * 1e-5f, 1e-7f);
+        const float inverseCell = 1.0f / tolerance;
+
+        std::unordered_map<uint64_t, std::vector<uint32_t>> grid;
+        grid.reserve(points.size());
+        vertices.reserve(points.size());
+
+        for (size_t i = 0; i < points.size(); i++) {
+            const utils::Vec3& point = points[i];
+            const int64_t cx =
+                static_cast<int64_t>(std::floor(point.x * inverseCell));
+            const int64_t cy =
+                static_cast<int64_t>(std::floor(point.y * inverseCell));
+            const int64_t cz =
+                static_cast<int64_t>(std::floor(point.z * inverseCell));
+
+            // Look for a welded vertex in the surrounding cells
+            uint32_t match = UINT32_MAX;
+            for (int64_t dx = -1; dx <= 1 && match == UINT32_MAX; dx++) {
+                for (int64_t dy = -1; dy <= 1 && match == UINT32_MAX; dy++) {
+                    for (int64_t dz = -1; dz <= 1; dz++) {
+                        const auto cell =
+                            grid.find(cellKey(cx + dx, cy + dy, cz + dz));
+                        if (cell == grid.end()) {
+                            continue;
+                        }
+                        for (uint32_t candidate : cell->second) {
+                            const utils::Vec3 offset =
+                                vertices[candidate] - point;
+                            if (offset.dot(offset) <= tolerance * tolerance) {
+                                match = candidate;
+                                break;
+                            }
+                        }
+                        if (match != UINT32_MAX) {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (match == UINT32_MAX) {
+                match = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(point);
+                grid[cellKey(cx, cy, cz)].push_back(match);
+            }
+            remap[i] = match;
+        }
+    }
+
+    /* Support
+    - Finds the vertex furthest along a direction. Small hulls, and hulls
+      built without triangles, are scanned; larger ones are hill-climbed
+      from the hint, which costs a few steps when the hint is the previous
+      result for a nearby direction.
+    - Parameters:
+        - direction: The search direction (need not be normalized).
+        - hint: The vertex to start climbing from.
+    - Returns: The index of the support vertex. */
+    uint32_t ConvexHull::support(
+        const utils::Vec3& direction,
+        uint32_t hint
+    ) const {
+        if (vertices.size() <= LINEAR_SCAN_LIMIT || adjacency.empty()) {
+            uint32_t best = 0;
+            float bestDot = vertices[0].dot(direction);
+            for (uint32_t i = 1; i < vertices.size(); i++) {
+                const float value = vertices[i].dot(direction);
+                if (value > bestDot) {
+                    bestDot = value;
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        uint32_t current = hint < vertices.size() ? hint : 0;
+        float currentDot = vertices[current].dot(direction);
+        while (true) {
+            // Steepest ascent: strict improvement rules out cycles
+            uint32_t next = current;
+            for (uint32_t i = adjacencyOffsets[current];
+                 i < adjacencyOffsets[current + 1];
+                 i++) {
+                const uint32_t neighbor = adjacency[i];
+                const float value = vertices[neighbor].dot(direction);
+                if (value > currentDot) {
+                    currentDot = value;
+                    next = neighbor;
+                }
+            }
+            if (next == current) {
+                return current;
+            }
+            current = next;
+        }
+    }
+
+    /* Get Vertex
+    - Returns: The welded vertex at an index. */
+    const utils::Vec3& ConvexHull::getVertex(uint32_t index) const {
+        return vertices[index];
+    }
+
+    /* Get Vertices
+    - Returns: Every welded vertex. */
+    const std::vector<utils::Vec3>& ConvexHull::getVertices() const {
+        return vertices;
+    }
+
+    /* Get Neighbor Count
+    - Returns: The number of vertices sharing an edge with a vertex. */
+    size_t ConvexHull::getNeighborCount(uint32_t index) const {
+        return adjacencyOffsets[index + 1] - adjacencyOffsets[index];
+    }
+
+    /* Get Bounds
+    - Returns: The bounds of the hull, in mesh space. */
+    const utils::AABB& ConvexHull::getBounds() const {
+        return bounds;
+    }
+
+    /* Get Mass Properties
+    - Returns: The mass properties of the solid hull, per unit mass. */
+    const utils::MassProperties& ConvexHull::getMassProperties() const {
+        return massProperties;
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,62 @@
+#ifndef OMELETTE_PHYSICS_CONVEXHULL_HPP
+#define OMELETTE_PHYSICS_CONVEXHULL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../utils/AABB.hpp"
+#include "../utils/IndexBuffer.hpp"
+#include "../utils/MassProperties.hpp"
+#include "../utils/Vec3.hpp"
+
+namespace omelette::physics {
+    // Convex vertex set with cached vertex adjacency. Support queries
+    // hill-climb the vertex graph from a hint vertex instead of scanning
+    // every vertex: on a convex mesh any vertex with no better neighbor is
+    // a global maximum. Coincident vertices (such as the seams and poles of
+    // a UV sphere) are welded so the graph stays connected.
+    class ConvexHull {
+      private:
+        // Welded vertices, in mesh space
+        std::vector<utils::Vec3> vertices;
+
+        // Neighbors of vertex i are adjacency[offsets[i]..offsets[i + 1])
+        std::vector<uint32_t> adjacencyOffsets;
+        std::vector<uint32_t> adjacency;
+
+        utils::AABB bounds; // Bounds of the vertices
+        utils::MassProperties massProperties; // Of the solid hull
+
+        // Weld vertices closer than a tolerance; fills remap with the
+        // welded index of every input vertex
+        void weld(
+            const std::vector<utils::Vec3>& points,
+            std::vector<uint32_t>& remap
+        );
+
+      public:
+        // Hulls this small are scanned linearly; climbing is not worth it
+        static constexpr size_t LINEAR_SCAN_LIMIT = 32;
+
+        // Build a hull from a non-empty triangle mesh, such as
+        // utils::Shapes output
+        ConvexHull(
+            const std::vector<utils::Vec3>& vertices,
+            const utils::IndexBuffer& indices
+        );
+
+        // Index of the vertex furthest along a direction, starting the
+        // search at a hint vertex (usually the previous result)
+        uint32_t support(const utils::Vec3& direction, uint32_t hint = 0) const;
+
+        // Getters
+        const utils::Vec3& getVertex(uint32_t index) const;
+        const std::vector<utils::Vec3>& getVertices() const;
+        size_t getNeighborCount(uint32_t index) const;
+        const utils::AABB& getBounds() const;
+        const utils::MassProperties& getMassProperties() const;
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_CONVEXHULL_HPP
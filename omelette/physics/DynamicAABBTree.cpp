@@ -0,0 +1,361 @@
+#include "DynamicAABBTree.hpp"
+
+#include <algorithm>
+
+namespace omelette::physics {
+    /* DynamicAABBTree Constructor
+    - Creates an empty tree.
+    - Parameters:
+        - margin: Distance the fat AABBs extend past the tight ones. */
+    DynamicAABBTree::DynamicAABBTree(float margin) : Broadphase(margin) {}
+
+    /* Allocate Node
+    - Takes a node from the free list, growing the pool if it is empty.
+    - Returns: The index of the node. */
+    int32_t DynamicAABBTree::allocateNode() {
+        if (freeList == NULL_NODE) {
+            nodes.emplace_back();
+            nodes.back().height = 0;
+            return static_cast<int32_t>(nodes.size() - 1);
+        }
+
+        const int32_t index = freeList;
+        freeList = nodes[index].parent;
+        nodes[index] = Node();
+        nodes[index].height = 0;
+        return index;
+    }
+
+    /* Free Node
+    - Returns a node to the free list.
+    - Parameters:
+        - node: The index of the node. */
+    void DynamicAABBTree::freeNode(int32_t node) {
+        nodes[node].parent = freeList;
+        nodes[node].height = -1;
+        freeList = node;
+    }
+
+    /* Create Proxy
+    - Inserts a leaf for an entity's fattened AABB.
+    - Parameters:
+        - aabb: The entity's tight AABB.
+        - entity: The entity owning the proxy.
+    - Returns: The proxy handle. */
+    ProxyId DynamicAABBTree::createProxy(
+        const utils::AABB& aabb,
+        omelette::ecs::Entity entity
+    ) {
+        const int32_t leaf = allocateNode();
+        nodes[leaf].aabb = fatten(aabb, utils::Vec3());
+        nodes[leaf].entity = entity;
+        insertLeaf(leaf);
+        proxyCount++;
+        return leaf;
+    }
+
+    /* Destroy Proxy
+    - Removes a proxy's leaf from the tree.
+    - Parameters:
+        - proxy: The proxy handle. */
+    void DynamicAABBTree::destroyProxy(ProxyId proxy) {
+        removeLeaf(proxy);
+        freeNode(proxy);
+        proxyCount--;
+    }
+
+    /* Move Proxy
+    - Updates a proxy. If the tight AABB is still inside the fat one nothing
+      happens; otherwise the leaf is refattened and re-inserted.
+    - Parameters:
+        - proxy: The proxy handle.
+        - aabb: The new tight AABB.
+        - displacement: The expected motion until the next update.
+    - Returns: True if the leaf was re-inserted. */
+    bool DynamicAABBTree::moveProxy(
+        ProxyId proxy,
+        const utils::AABB& aabb,
+        const utils::Vec3& displacement
+    ) {
+        if (nodes[proxy].aabb.contains(aabb)) {
+            return false;
+        }
+
+        removeLeaf(proxy);
+        nodes[proxy].aabb = fatten(aabb, displacement);
+        insertLeaf(proxy);
+        return true;
+    }
+
+    /* Get Fat AABB
+    - Returns: The fat AABB stored for a proxy. */
+    const utils::AABB& DynamicAABBTree::getFatAABB(ProxyId proxy) const {
+        return nodes[proxy].aabb;
+    }
+
+    /* Get Proxy Count
+    - Returns: The number of live proxies. */
+    size_t DynamicAABBTree::getProxyCount() const {
+        return proxyCount;
+    }
+
+    /* Get Height
+    - Returns: The height of the tree, or -1 if it is empty. */
+    int32_t DynamicAABBTree::getHeight() const {
+        return root == NULL_NODE ? -1 : nodes[root].height;
+    }
+
+    /* Compute Pairs
+    - Queries the tree with every leaf's fat AABB. Each pair is reported by
+      its lower-index leaf only, so the output holds no duplicates.
+    - Parameters:
+        - pairs: Replaced with the overlapping pairs, sorted. */
+    void DynamicAABBTree::computePairs(std::vector<BroadphasePair>& pairs) {
+        pairs.clear();
+        for (int32_t leaf = 0; leaf < static_cast<int32_t>(nodes.size());
+             leaf++) {
+            if (nodes[leaf].height != 0) {
+                continue;
+            }
+
+            const auto entity = nodes[leaf].entity;
+            query(nodes[leaf].aabb, [&](int32_t other) {
+                if (other > leaf) {
+                    const auto otherEntity = nodes[other].entity;
+                    pairs.push_back(
+                        entity < otherEntity
+                            ? BroadphasePair{entity, otherEntity}
+                            : BroadphasePair{otherEntity, entity}
+                    );
+                }
+                return true;
+            });
+        }
+        std::sort(pairs.begin(), pairs.end());
+    }
+
+    /* Insert Leaf
+    - Descends from the root choosing the child whose enlargement costs
+      least, pairs the leaf with the node where descending stops being
+      cheaper, then refits and rebalances the path back to the root.
+    - Parameters:
+        - leaf: The leaf node to insert. */
+    void DynamicAABBTree::insertLeaf(int32_t leaf) {
+        if (root == NULL_NODE) {
+            root = leaf;
+            nodes[root].parent = NULL_NODE;
+            return;
+        }
+
+        const utils::AABB leafAABB = nodes[leaf].aabb;
+        int32_t index = root;
+        while (!nodes[index].isLeaf()) {
+            const int32_t child1 = nodes[index].child1;
+            const int32_t child2 = nodes[index].child2;
+
+            const float area = nodes[index].aabb.perimeter();
+            const float combinedArea =
+                utils::AABB::merge(nodes[index].aabb, leafAABB).perimeter();
+
+            // Cost of pairing the leaf with this node
+            const float cost = 2.0f * combinedArea;
+
+            // Minimum cost pushed down to the children
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](int32_t child) {
+                const float merged =
+                    utils::AABB::merge(leafAABB, nodes[child].aabb).perimeter();
+                if (nodes[child].isLeaf()) {
+                    return merged + inheritanceCost;
+                }
+                return merged - nodes[child].aabb.perimeter() + inheritanceCost;
+            };
+
+            const float cost1 = descendCost(child1);
+            const float cost2 = descendCost(child2);
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? child1 : child2;
+        }
+
+        // Pair the leaf with the sibling under a new parent
+        const int32_t sibling = index;
+        const int32_t oldParent = nodes[sibling].parent;
+        const int32_t newParent = allocateNode();
+        nodes[newParent].parent = oldParent;
+        nodes[newParent].aabb =
+            utils::AABB::merge(leafAABB, nodes[sibling].aabb);
+        nodes[newParent].height = nodes[sibling].height + 1;
+        nodes[newParent].child1 = sibling;
+        nodes[newParent].child2 = leaf;
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE) {
+            root = newParent;
+        } else if (nodes[oldParent].child1 == sibling) {
+            nodes[oldParent].child1 = newParent;
+        } else {
+            nodes[oldParent].child2 = newParent;
+        }
+
+        refitAncestors(leaf);
+    }
+
+    /* Remove Leaf
+    - Detaches a leaf, replaces its parent with its sibling and refits the
+      path back to the root. The leaf node itself is not freed.
+    - Parameters:
+        - leaf: The leaf node to remove. */
+    void DynamicAABBTree::removeLeaf(int32_t leaf) {
+        if (leaf == root) {
+            root = NULL_NODE;
+            return;
+        }
+
+        const int32_t parent = nodes[leaf].parent;
+        const int32_t grandParent = nodes[parent].parent;
+        const int32_t sibling = nodes[parent].child1 == leaf
+            ? nodes[parent].child2
+            : nodes[parent].child1;
+
+        if (grandParent == NULL_NODE) {
+            root = sibling;
+            nodes[sibling].parent = NULL_NODE;
+            freeNode(parent);
+            return;
+        }
+
+        if (nodes[grandParent].child1 == parent) {
+            nodes[grandParent].child1 = sibling;
+        } else {
+            nodes[grandParent].child2 = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitAncestors(sibling);
+    }
+
+    /* Refit Ancestors
+    - Rebalances every ancestor of a node and recomputes its AABB and
+      height, walking up to the root.
+    - Parameters:
+        - node: The node whose ancestors changed. */
+    void DynamicAABBTree::refitAncestors(int32_t node) {
+        int32_t index = nodes[node].parent;
+        while (index != NULL_NODE) {
+            index = balance(index);
+
+            const int32_t child1 = nodes[index].child1;
+            const int32_t child2 = nodes[index].child2;
+            nodes[index].height =
+                1 + std::max(nodes[child1].height, nodes[child2].height);
+            nodes[index].aabb =
+                utils::AABB::merge(nodes[child1].aabb, nodes[child2].aabb);
+
+            index = nodes[index].parent;
+        }
+    }
+
+    /* Balance
+    - Performs a left or right rotation if one child of a node is more than
+      one level taller than the other.
+    - Parameters:
+        - iA: The node to balance.
+    - Returns: The index of the node now at the top of the subtree. */
+    int32_t DynamicAABBTree::balance(int32_t iA) {
+        Node& A = nodes[iA];
+        if (A.isLeaf() || A.height < 2) {
+            return iA;
+        }
+
+        const int32_t iB = A.child1;
+        const int32_t iC = A.child2;
+        Node& B = nodes[iB];
+        Node& C = nodes[iC];
+        const int32_t balanceFactor = C.height - B.height;
+
+        // Rotate C up
+        if (balanceFactor > 1) {
+            const int32_t iF = C.child1;
+            const int32_t iG = C.child2;
+            Node& F = nodes[iF];
+            Node& G = nodes[iG];
+
+            C.child1 = iA;
+            C.parent = A.parent;
+            A.parent = iC;
+
+            if (C.parent == NULL_NODE) {
+                root = iC;
+            } else if (nodes[C.parent].child1 == iA) {
+                nodes[C.parent].child1 = iC;
+            } else {
+                nodes[C.parent].child2 = iC;
+            }
+
+            if (F.height > G.height) {
+                C.child2 = iF;
+                A.child2 = iG;
+                G.parent = iA;
+                A.aabb = utils::AABB::merge(B.aabb, G.aabb);
+                C.aabb = utils::AABB::merge(A.aabb, F.aabb);
+                A.height = 1 + std::max(B.height, G.height);
+                C.height = 1 + std::max(A.height, F.height);
+            } else {
+                C.child2 = iG;
+                A.child2 = iF;
+                F.parent = iA;
+                A.aabb = utils::AABB::merge(B.aabb, F.aabb);
+                C.aabb = utils::AABB::merge(A.aabb, G.aabb);
+                A.height = 1 + std::max(B.height, F.height);
+                C.height = 1 + std::max(A.height, G.height);
+            }
+            return iC;
+        }
+
+        // Rotate B up
+        if (balanceFactor < -1) {
+            const int32_t iD = B.child1;
+            const int32_t iE = B.child2;
+            Node& D = nodes[iD];
+            Node& E = nodes[iE];
+
+            B.child1 = iA;
+            B.parent = A.parent;
+            A.parent = iB;
+
+            if (B.parent == NULL_NODE) {
+                root = iB;
+            } else if (nodes[B.parent].child1 == iA) {
+                nodes[B.parent].child1 = iB;
+            } else {
+                nodes[B.parent].child2 = iB;
+            }
+
+            if (D.height > E.height) {
+                B.child2 = iD;
+                A.child1 = iE;
+                E.parent = iA;
+                A.aabb = utils::AABB::merge(C.aabb, E.aabb);
+                B.aabb = utils::AABB::merge(A.aabb, D.aabb);
+                A.height = 1 + std::max(C.height, E.height);
+                B.height = 1 + std::max(A.height, D.height);
+            } else {
+                B.child2 = iE;
+                A.child1 = iD;
+                D.parent = iA;
+                A.aabb = utils::AABB::merge(C.aabb, D.aabb);
+                B.aabb = utils::AABB::merge(A.aabb, E.aabb);
+                A.height = 1 + std::max(C.height, D.height);
+                B.height = 1 + std::max(A.height, E.height);
+            }
+            return iB;
+        }
+
+        return iA;
+    }
+}; // namespace omelette::physics
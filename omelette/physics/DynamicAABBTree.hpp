@@ -0,0 +1,124 @@
+#ifndef OMELETTE_PHYSICS_DYNAMICAABBTREE_HPP
+#define OMELETTE_PHYSICS_DYNAMICAABBTREE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "Broadphase.hpp"
+
+namespace omelette::physics {
+    // Bounding volume hierarchy of fat AABBs. Leaves are inserted where they
+    // grow the tree's perimeter the least, and the tree is kept balanced
+    // with AVL-style rotations. Moving a proxy whose tight box left its fat
+    // box removes and re-inserts just that leaf, refitting its ancestors.
+    class DynamicAABBTree: public Broadphase {
+      private:
+        static constexpr int32_t NULL_NODE = -1;
+
+        struct Node {
+            utils::AABB aabb; // Fat AABB (leaves) or union of children
+            omelette::ecs::Entity entity; // Owning entity (leaves only)
+            int32_t parent = NULL_NODE; // Parent, or next free node
+            int32_t child1 = NULL_NODE;
+            int32_t child2 = NULL_NODE;
+            int32_t height = -1; // 0 for leaves, -1 for free nodes
+
+            bool isLeaf() const {
+                return child1 == NULL_NODE;
+            }
+        };
+
+        // Node pool; proxies are leaf node indices
+        std::vector<Node> nodes;
+
+        // Root node of the tree
+        int32_t root = NULL_NODE;
+
+        // Head of the free node list
+        int32_t freeList = NULL_NODE;
+
+        // Number of live proxies
+        size_t proxyCount = 0;
+
+        // Reusable traversal stack
+        std::vector<int32_t> stack;
+
+        int32_t allocateNode();
+        void freeNode(int32_t node);
+        void insertLeaf(int32_t leaf);
+        void removeLeaf(int32_t leaf);
+
+        // Rotate a node's subtree if it is imbalanced; returns its new root
+        int32_t balance(int32_t node);
+
+        // Recompute the AABB and height of every ancestor of a node
+        void refitAncestors(int32_t node);
+
+      public:
+        explicit DynamicAABBTree(float margin = 0.1f);
+
+        ProxyId createProxy(
+            const utils::AABB& aabb,
+            omelette::ecs::Entity entity
+        ) override;
+
+        void destroyProxy(ProxyId proxy) override;
+
+        bool moveProxy(
+            ProxyId proxy,
+            const utils::AABB& aabb,
+            const utils::Vec3& displacement
+        ) override;
+
+        const utils::AABB& getFatAABB(ProxyId proxy) const override;
+
+        size_t getProxyCount() const override;
+
+        void computePairs(std::vector<BroadphasePair>& pairs) override;
+
+        // Call callback(proxy) for every proxy whose fat AABB overlaps a box;
+        // the callback returns false to stop the query early
+        template<typename Callback>
+        void query(const utils::AABB& aabb, Callback&& callback);
+
+        // Height of the tree (0 for a single leaf)
+        int32_t getHeight() const;
+    };
+
+    /* Query
+    - Walks every subtree whose AABB overlaps a box.
+    - Parameters:
+        - aabb: The box to test.
+        - callback: Called as callback(proxy) for each overlapping leaf;
+          returning false stops the query. */
+    template<typename Callback>
+    void DynamicAABBTree::query(const utils::AABB& aabb, Callback&& callback) {
+        if (root == NULL_NODE) {
+            return;
+        }
+
+        const size_t base = stack.size();
+        stack.push_back(root);
+        while (stack.size() > base) {
+            const int32_t index = stack.back();
+            stack.pop_back();
+
+            const Node& node = nodes[index];
+            if (!node.aabb.overlaps(aabb)) {
+                continue;
+            }
+
+            if (node.isLeaf()) {
+                if (!callback(index)) {
+                    stack.resize(base);
+                    return;
+                }
+            } else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_DYNAMICAABBTREE_HPP
@@ -0,0 +1,203 @@
+#include "Integrator.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define OMELETTE_INTEGRATOR_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace omelette::physics::Integrator {
+    namespace {
+        /* Integrate Axis Scalar
+        - Integrates one axis of rows [begin, count) one body at a time. */
+        void integrateAxisScalar(
+            float* position,
+            float* velocity,
+            float* acceleration,
+            size_t begin,
+            size_t count,
+            float deltaTime
+        ) {
+            for (size_t i = begin; i < count; i++) {
+                velocity[i] = velocity[i] + acceleration[i] * deltaTime;
+                position[i] = position[i] + velocity[i] * deltaTime;
+                acceleration[i] = 0.0f;
+            }
+        }
+
+#ifdef OMELETTE_INTEGRATOR_X86
+        /* Integrate Axis SSE2
+        - Integrates one axis four bodies at a time. */
+        __attribute__((target("sse2"))) void integrateAxisSSE2(
+            float* position,
+            float* velocity,
+            float* acceleration,
+            size_t count,
+            float deltaTime
+        ) {
+            const __m128 step = _mm_set1_ps(deltaTime);
+            const __m128 zero = _mm_setzero_ps();
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 v = _mm_loadu_ps(velocity + i);
+                __m128 p = _mm_loadu_ps(position + i);
+                const __m128 a = _mm_loadu_ps(acceleration + i);
+
+                v = _mm_add_ps(v, _mm_mul_ps(a, step));
+                p = _mm_add_ps(p, _mm_mul_ps(v, step));
+
+                _mm_storeu_ps(velocity + i, v);
+                _mm_storeu_ps(position + i, p);
+                _mm_storeu_ps(acceleration + i, zero);
+            }
+            integrateAxisScalar(
+                position,
+                velocity,
+                acceleration,
+                i,
+                count,
+                deltaTime
+            );
+        }
+
+        /* Integrate Axis AVX
+        - Integrates one axis eight bodies at a time. */
+        __attribute__((target("avx"))) void integrateAxisAVX(
+            float* position,
+            float* velocity,
+            float* acceleration,
+            size_t count,
+            float deltaTime
+        ) {
+            const __m256 step = _mm256_set1_ps(deltaTime);
+            const __m256 zero = _mm256_setzero_ps();
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 v = _mm256_loadu_ps(velocity + i);
+                __m256 p = _mm256_loadu_ps(position + i);
+                const __m256 a = _mm256_loadu_ps(acceleration + i);
+
+                v = _mm256_add_ps(v, _mm256_mul_ps(a, step));
+                p = _mm256_add_ps(p, _mm256_mul_ps(v, step));
+
+                _mm256_storeu_ps(velocity + i, v);
+                _mm256_storeu_ps(position + i, p);
+                _mm256_storeu_ps(acceleration + i, zero);
+            }
+            integrateAxisScalar(
+                position,
+                velocity,
+                acceleration,
+                i,
+                count,
+                deltaTime
+            );
+        }
+#endif
+    } // namespace
+
+    /* Get SIMD Level
+    - Returns: The SIMD level used by integrate(bodies, deltaTime). */
+    SimdLevel getSimdLevel() {
+        return omelette::utils::getSimdLevel();
+    }
+
+    /* Integrate
+    - Integrates SoA body state with the best supported kernel.
+    - Parameters:
+        - bodies: The body arrays to integrate in place.
+        - deltaTime: The time step to integrate by. */
+    void integrate(const BodyArrays& bodies, float deltaTime) {
+        integrate(bodies, deltaTime, getSimdLevel());
+    }
+
+    /* Integrate
+    - Integrates SoA body state with a specific kernel. Requesting a level
+      the build does not support falls back to the scalar kernel.
+    - Parameters:
+        - bodies: The body arrays to integrate in place.
+        - deltaTime: The time step to integrate by.
+        - level: The kernel to use. */
+    void integrate(const BodyArrays& bodies, float deltaTime, SimdLevel level) {
+        float* const positions[] = {
+            bodies.positionX,
+            bodies.positionY,
+            bodies.positionZ
+        };
+        float* const velocities[] = {
+            bodies.velocityX,
+            bodies.velocityY,
+            bodies.velocityZ
+        };
+        float* const accelerations[] = {
+            bodies.accelerationX,
+            bodies.accelerationY,
+            bodies.accelerationZ
+        };
+
+        for (int axis = 0; axis < 3; axis++) {
+            switch (level) {
+#ifdef OMELETTE_INTEGRATOR_X86
+                case SimdLevel::AVX:
+                    integrateAxisAVX(
+                        positions[axis],
+                        velocities[axis],
+                        accelerations[axis],
+                        bodies.count,
+                        deltaTime
+                    );
+                    break;
+                case SimdLevel::SSE2:
+                    integrateAxisSSE2(
+                        positions[axis],
+                        velocities[axis],
+                        accelerations[axis],
+                        bodies.count,
+                        deltaTime
+                    );
+                    break;
+#endif
+                default:
+                    integrateAxisScalar(
+                        positions[axis],
+                        velocities[axis],
+                        accelerations[axis],
+                        0,
+                        bodies.count,
+                        deltaTime
+                    );
+                    break;
+            }
+        }
+    }
+
+    /* Integrate
+    - Integrates rigid body components in place, with the same multiply and
+      add per axis as the SoA kernels, so results match them bit for bit.
+      The loop is bound by memory bandwidth over the components, so
+      transposing them into SoA blocks and back would only add copies.
+    - Parameters:
+        - bodies: The rigid bodies to integrate in place.
+        - count: The number of bodies.
+        - deltaTime: The time step to integrate by. */
+    void integrate(
+        omelette::ecs::components::RigidBodyComponent* bodies,
+        size_t count,
+        float deltaTime
+    ) {
+        for (size_t i = 0; i < count; i++) {
+            auto& velocity = bodies[i].velocity;
+            auto& position = bodies[i].position;
+            auto& acceleration = bodies[i].acceleration;
+
+            velocity.x = velocity.x + acceleration.x * deltaTime;
+            velocity.y = velocity.y + acceleration.y * deltaTime;
+            velocity.z = velocity.z + acceleration.z * deltaTime;
+            position.x = position.x + velocity.x * deltaTime;
+            position.y = position.y + velocity.y * deltaTime;
+            position.z = position.z + velocity.z * deltaTime;
+            acceleration = omelette::utils::Vec3();
+        }
+    }
+}; // namespace omelette::physics::Integrator
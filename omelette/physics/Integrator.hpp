@@ -0,0 +1,58 @@
+#ifndef OMELETTE_PHYSICS_INTEGRATOR_HPP
+#define OMELETTE_PHYSICS_INTEGRATOR_HPP
+
+#include <cstddef>
+
+#include "../ecs/Components/RigidBodyComponent.hpp"
+#include "../utils/Simd.hpp"
+
+// Batched semi-implicit Euler integration:
+//     velocity += acceleration * deltaTime
+//     position += velocity * deltaTime
+//     acceleration = 0
+//
+// Every kernel performs the same IEEE multiply and add per lane, in the same
+// order, without fused multiply-add, so SSE and AVX results are bit-identical
+// to the scalar path (tolerance: 0 ULP). If the library is built with FP
+// contraction into FMA, the scalar path may differ by at most 1 ULP per
+// component per step.
+//
+// The SIMD kernels take structure-of-arrays state. Rigid body components
+// are integrated in place instead: copying them into SoA and back costs
+// more than the arithmetic the kernels speed up.
+namespace omelette::physics::Integrator {
+    // Instruction set used by the kernels
+    using SimdLevel = omelette::utils::SimdLevel;
+
+    // Structure-of-arrays body state; every array holds count floats
+    struct BodyArrays {
+        float* positionX;
+        float* positionY;
+        float* positionZ;
+        float* velocityX;
+        float* velocityY;
+        float* velocityZ;
+        float* accelerationX;
+        float* accelerationY;
+        float* accelerationZ;
+        size_t count;
+    };
+
+    // Best instruction set supported by the running CPU
+    SimdLevel getSimdLevel();
+
+    // Integrate SoA body state with the best supported kernel
+    void integrate(const BodyArrays& bodies, float deltaTime);
+
+    // Integrate SoA body state with a specific kernel
+    void integrate(const BodyArrays& bodies, float deltaTime, SimdLevel level);
+
+    // Integrate rigid body components in place, one body at a time
+    void integrate(
+        omelette::ecs::components::RigidBodyComponent* bodies,
+        size_t count,
+        float deltaTime
+    );
+}; // namespace omelette::physics::Integrator
+
+#endif // OMELETTE_PHYSICS_INTEGRATOR_HPP
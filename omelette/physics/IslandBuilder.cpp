@@ -0,0 +1,118 @@
+#include "IslandBuilder.hpp"
+
+#include <utility>
+
+namespace omelette::physics {
+    /* Reset
+    - Makes every body its own island.
+    - Parameters:
+        - bodyCount: The number of bodies. */
+    void IslandBuilder::reset(size_t bodyCount) {
+        parents.resize(bodyCount);
+        sizes.assign(bodyCount, 1);
+        for (size_t i = 0; i < bodyCount; i++) {
+            parents[i] = static_cast<uint32_t>(i);
+        }
+        islandBodies.clear();
+        islandOffsets.clear();
+        bodyIslands.clear();
+    }
+
+    /* Find
+    - Follows parent links to the representative of a body's set, pointing
+      every visited body at its grandparent on the way.
+    - Parameters:
+        - body: The body.
+    - Returns: The representative body. */
+    uint32_t IslandBuilder::find(uint32_t body) {
+        while (parents[body] != body) {
+            parents[body] = parents[parents[body]];
+            body = parents[body];
+        }
+        return body;
+    }
+
+    /* Link
+    - Merges the sets of two bodies, attaching the smaller under the
+      larger.
+    - Parameters:
+        - bodyA: The first body.
+        - bodyB: The second body. */
+    void IslandBuilder::link(uint32_t bodyA, uint32_t bodyB) {
+        uint32_t rootA = find(bodyA);
+        uint32_t rootB = find(bodyB);
+        if (rootA == rootB) {
+            return;
+        }
+        if (sizes[rootA] < sizes[rootB]) {
+            std::swap(rootA, rootB);
+        }
+        parents[rootB] = rootA;
+        sizes[rootA] += sizes[rootB];
+    }
+
+    /* Build
+    - Numbers the islands in order of their first body and counting-sorts
+      the bodies by island.
+    - Parameters:
+        - scratch: Where temporaries are allocated, e.g. a frame arena. */
+    void IslandBuilder::build(std::pmr::memory_resource* scratch) {
+        const size_t bodyCount = parents.size();
+        constexpr uint32_t UNASSIGNED = UINT32_MAX;
+
+        // Island number of every representative
+        std::pmr::vector<uint32_t> rootIslands(bodyCount, UNASSIGNED, scratch);
+        bodyIslands.resize(bodyCount);
+        islandOffsets.assign(1, 0);
+        for (uint32_t body = 0; body < bodyCount; body++) {
+            const uint32_t root = find(body);
+            if (rootIslands[root] == UNASSIGNED) {
+                rootIslands[root] =
+                    static_cast<uint32_t>(islandOffsets.size() - 1);
+                islandOffsets.push_back(0);
+            }
+            bodyIslands[body] = rootIslands[root];
+            islandOffsets[bodyIslands[body] + 1]++;
+        }
+
+        for (size_t i = 1; i < islandOffsets.size(); i++) {
+            islandOffsets[i] += islandOffsets[i - 1];
+        }
+        std::pmr::vector<size_t> cursor(
+            islandOffsets.begin(),
+            islandOffsets.end() - 1,
+            scratch
+        );
+        islandBodies.resize(bodyCount);
+        for (uint32_t body = 0; body < bodyCount; body++) {
+            islandBodies[cursor[bodyIslands[body]]++] = body;
+        }
+    }
+
+    /* Get Island Count
+    - Returns: The number of islands from the last build. */
+    size_t IslandBuilder::getIslandCount() const {
+        return islandOffsets.empty() ? 0 : islandOffsets.size() - 1;
+    }
+
+    /* Get Bodies
+    - Returns: The bodies grouped by island. */
+    const std::vector<uint32_t>& IslandBuilder::getBodies() const {
+        return islandBodies;
+    }
+
+    /* Get Offsets
+    - Returns: Where each island starts in the grouped bodies, plus the
+      total body count at the end. */
+    const std::vector<size_t>& IslandBuilder::getOffsets() const {
+        return islandOffsets;
+    }
+
+    /* Get Island
+    - Parameters:
+        - body: The body.
+    - Returns: The island of the body after the last build. */
+    uint32_t IslandBuilder::getIsland(uint32_t body) const {
+        return bodyIslands[body];
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,56 @@
+#ifndef OMELETTE_PHYSICS_ISLANDBUILDER_HPP
+#define OMELETTE_PHYSICS_ISLANDBUILDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace omelette::physics {
+    // Groups bodies into islands: the connected components of the contact
+    // graph. Bodies are indices in [0, bodyCount); static bodies should not
+    // be linked, since they do not carry motion from one body to another.
+    //
+    // Links are merged with a union-find (union by size, path halving), so
+    // building is close to linear in bodies plus links.
+    class IslandBuilder {
+      private:
+        // Union-find parent and set size of every body
+        std::vector<uint32_t> parents;
+        std::vector<uint32_t> sizes;
+
+        // Bodies grouped by island, and where each island starts
+        std::vector<uint32_t> islandBodies;
+        std::vector<size_t> islandOffsets;
+
+        // Island of every body after build()
+        std::vector<uint32_t> bodyIslands;
+
+        // Representative of a body's set
+        uint32_t find(uint32_t body);
+
+      public:
+        // Start over with bodyCount unlinked bodies
+        void reset(size_t bodyCount);
+
+        // Put two bodies in the same island
+        void link(uint32_t bodyA, uint32_t bodyB);
+
+        // Group the bodies by island; temporaries use scratch
+        void build(
+            std::pmr::memory_resource* scratch =
+                std::pmr::get_default_resource()
+        );
+
+        // Islands from the last build; the bodies of island i are in
+        // getBodies()[getOffsets()[i]..getOffsets()[i + 1])
+        size_t getIslandCount() const;
+        const std::vector<uint32_t>& getBodies() const;
+        const std::vector<size_t>& getOffsets() const;
+
+        // Island of a body after the last build
+        uint32_t getIsland(uint32_t body) const;
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_ISLANDBUILDER_HPP
@@ -0,0 +1,979 @@
+#include "Narrowphase.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace omelette::physics::Narrowphase {
+    namespace {
+        constexpr int GJK_MAX_ITERATIONS = 64;
+        constexpr int EPA_MAX_ITERATIONS = 128;
+
+        // GJK stops when an iteration improves the distance by less than
+        // this fraction of the squared distance
+        constexpr float GJK_RELATIVE_TOLERANCE = 1e-5f;
+
+        // Squared distance, relative to the simplex size, treated as zero
+        constexpr float GJK_OVERLAP_TOLERANCE = 1e-10f;
+
+        // EPA stops when the polytope grows by less than this
+        constexpr float EPA_TOLERANCE = 1e-4f;
+
+        // Component of a vector along an axis
+        float axisValue(const utils::Vec3& v, int axis) {
+            return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+        }
+
+        // Set the component of a vector along an axis
+        void setAxisValue(utils::Vec3& v, int axis, float value) {
+            (axis == 0 ? v.x : (axis == 1 ? v.y : v.z)) = value;
+        }
+
+        // Swap the roles of A and B in a contact
+        void flip(Contact& contact) {
+            contact.normal = contact.normal * -1.0f;
+            std::swap(contact.pointA, contact.pointB);
+        }
+
+        // Point of the Minkowski difference A - B with its witnesses
+        struct SupportPoint {
+            utils::Vec3 w; // a - b
+            utils::Vec3 a; // Support point of A, world space
+            utils::Vec3 b; // Support point of B, world space
+            uint32_t vertexA; // Hull vertex of A, to climb from later
+            uint32_t vertexB; // Hull vertex of B, to climb from later
+        };
+
+        // Support mapping of the difference of two core shapes
+        struct MinkowskiDifference {
+            const Shape& shapeA;
+            utils::Vec3 positionA;
+            const Shape& shapeB;
+            utils::Vec3 positionB;
+            uint32_t hintA;
+            uint32_t hintB;
+
+            SupportPoint support(const utils::Vec3& direction) {
+                const utils::Vec3 a =
+                    shapeA.coreSupport(direction, hintA) + positionA;
+                const utils::Vec3 b =
+                    shapeB.coreSupport(direction * -1.0f, hintB) + positionB;
+                return {a - b, a, b, hintA, hintB};
+            }
+        };
+
+        // Up to four support points and the barycentric weights of the
+        // simplex point closest to the origin
+        struct Simplex {
+            SupportPoint points[4];
+            float weights[4];
+            int size = 0;
+
+            void keep(std::initializer_list<std::pair<int, float>> kept) {
+                SupportPoint reduced[4];
+                int count = 0;
+                for (const auto& entry : kept) {
+                    reduced[count] = points[entry.first];
+                    weights[count] = entry.second;
+                    count++;
+                }
+                std::copy(reduced, reduced + count, points);
+                size = count;
+            }
+
+            // Weighted sum of the simplex points
+            utils::Vec3 closest() const {
+                utils::Vec3 result;
+                for (int i = 0; i < size; i++) {
+                    result += points[i].w * weights[i];
+                }
+                return result;
+            }
+        };
+
+        /* Closest On Segment
+        - Reduces a two-point simplex to the feature closest to the origin. */
+        void closestOnSegment(Simplex& simplex) {
+            const utils::Vec3 a = simplex.points[0].w;
+            const utils::Vec3 ab = simplex.points[1].w - a;
+            const float lengthSquared = ab.dot(ab);
+            const float t =
+                lengthSquared > 0.0f ? -a.dot(ab) / lengthSquared : 0.0f;
+
+            if (t <= 0.0f) {
+                simplex.keep({{0, 1.0f}});
+            } else if (t >= 1.0f) {
+                simplex.keep({{1, 1.0f}});
+            } else {
+                simplex.keep({{0, 1.0f - t}, {1, t}});
+            }
+        }
+
+        /* Closest On Triangle
+        - Reduces a simplex to the feature of triangle (i, j, k) closest to
+          the origin, by Voronoi region tests. */
+        void closestOnTriangle(Simplex& simplex, int i, int j, int k) {
+            const utils::Vec3 a = simplex.points[i].w;
+            const utils::Vec3 b = simplex.points[j].w;
+            const utils::Vec3 c = simplex.points[k].w;
+            const utils::Vec3 ab = b - a;
+            const utils::Vec3 ac = c - a;
+
+            const float d1 = -ab.dot(a);
+            const float d2 = -ac.dot(a);
+            if (d1 <= 0.0f && d2 <= 0.0f) {
+                simplex.keep({{i, 1.0f}});
+                return;
+            }
+
+            const float d3 = -ab.dot(b);
+            const float d4 = -ac.dot(b);
+            if (d3 >= 0.0f && d4 <= d3) {
+                simplex.keep({{j, 1.0f}});
+                return;
+            }
+
+            const float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+                const float v = d1 / (d1 - d3);
+                simplex.keep({{i, 1.0f - v}, {j, v}});
+                return;
+            }
+
+            const float d5 = -ab.dot(c);
+            const float d6 = -ac.dot(c);
+            if (d6 >= 0.0f && d5 <= d6) {
+                simplex.keep({{k, 1.0f}});
+                return;
+            }
+
+            const float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+                const float w = d2 / (d2 - d6);
+                simplex.keep({{i, 1.0f - w}, {k, w}});
+                return;
+            }
+
+            const float va = d3 * d6 - d5 * d4;
+            if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+                const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                simplex.keep({{j, 1.0f - w}, {k, w}});
+                return;
+            }
+
+            const float denominator = 1.0f / (va + vb + vc);
+            const float v = vb * denominator;
+            const float w = vc * denominator;
+            simplex.keep({{i, 1.0f - v - w}, {j, v}, {k, w}});
+        }
+
+        /* Closest On Tetrahedron
+        - Reduces a four-point simplex to the face feature closest to the
+          origin. Returns false, keeping all four points, if the origin is
+          inside the tetrahedron. */
+        bool closestOnTetrahedron(Simplex& simplex) {
+            static constexpr int FACES[4][4] = {
+                {0, 1, 2, 3},
+                {0, 3, 1, 2},
+                {0, 2, 3, 1},
+                {1, 3, 2, 0}
+            };
+
+            Simplex best;
+            float bestDistance = INFINITY;
+            bool outside = false;
+
+            for (const auto& face : FACES) {
+                const utils::Vec3 a = simplex.points[face[0]].w;
+                const utils::Vec3 ab = simplex.points[face[1]].w - a;
+                const utils::Vec3 ac = simplex.points[face[2]].w - a;
+                const utils::Vec3 normal = ab.cross(ac);
+                const float originSide = -a.dot(normal);
+                const float oppositeSide =
+                    (simplex.points[face[3]].w - a).dot(normal);
+
+                // Faces of a flat tetrahedron are all candidates
+                if (originSide * oppositeSide >= 0.0f && oppositeSide != 0.0f) {
+                    continue;
+                }
+
+                outside = true;
+                Simplex candidate = simplex;
+                closestOnTriangle(candidate, face[0], face[1], face[2]);
+                const utils::Vec3 point = candidate.closest();
+                const float distance = point.dot(point);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = candidate;
+                }
+            }
+
+            if (!outside) {
+                for (float& weight : simplex.weights) {
+                    weight = 0.25f;
+                }
+                return false;
+            }
+            simplex = best;
+            return true;
+        }
+
+        // Outcome of a GJK distance query
+        struct GjkResult {
+            bool overlapping = false;
+            float distance = 0.0f; // Core distance if not overlapping
+            utils::Vec3 pointA; // Closest point of core A
+            utils::Vec3 pointB; // Closest point of core B
+            utils::Vec3 direction; // Search direction for the next query
+            Simplex simplex; // Final simplex, seeding EPA
+        };
+
+        /* GJK
+        - Computes the distance between two core shapes, stopping early once
+          it is known to exceed a limit.
+        - Parameters:
+            - difference: The support mapping of A - B.
+            - direction: Initial search direction, from A towards B; zero
+              picks the direction between the shape positions.
+            - limit: Distance beyond which the exact value is not needed.
+        - Returns: The distance, closest points and final simplex. If the
+          initial direction already separates the cores by more than the
+          limit, the distance is only an upper bound. */
+        GjkResult gjk(
+            MinkowskiDifference& difference,
+            utils::Vec3 direction,
+            float limit
+        ) {
+            GjkResult result;
+            Simplex& simplex = result.simplex;
+
+            if (direction.dot(direction) == 0.0f) {
+                direction = difference.positionB - difference.positionA;
+                if (direction.dot(direction) == 0.0f) {
+                    direction = utils::Vec3(1.0f, 0.0f, 0.0f);
+                }
+            }
+
+            simplex.points[0] = difference.support(direction);
+            simplex.weights[0] = 1.0f;
+            simplex.size = 1;
+            utils::Vec3 v = simplex.points[0].w;
+            result.direction = direction;
+
+            // A cached separating axis usually still separates: one support
+            // query then settles the test, and the axis stays cached
+            const float axisDistance = v.dot(direction);
+            const bool axisSeparates = axisDistance < 0.0f
+                && axisDistance * axisDistance
+                    > limit * limit * direction.dot(direction);
+
+            for (int iteration = 0;
+                 !axisSeparates && iteration < GJK_MAX_ITERATIONS;
+                 iteration++) {
+                const float vv = v.dot(v);
+
+                float scale = 0.0f;
+                for (int i = 0; i < simplex.size; i++) {
+                    scale = std::max(
+                        scale,
+                        simplex.points[i].w.dot(simplex.points[i].w)
+                    );
+                }
+                if (vv <= GJK_OVERLAP_TOLERANCE * std::max(scale, 1.0f)) {
+                    result.overlapping = true;
+                    return result;
+                }
+
+                const SupportPoint w = difference.support(v * -1.0f);
+                const float vw = v.dot(w.w);
+
+                // The plane through w separates the cores by vw / |v|
+                if (vw > 0.0f && vw * vw > limit * limit * vv) {
+                    break;
+                }
+
+                // No progress towards the origin: v is the closest point
+                if (vv - vw <= GJK_RELATIVE_TOLERANCE * vv) {
+                    break;
+                }
+
+                simplex.points[simplex.size++] = w;
+                switch (simplex.size) {
+                    case 2:
+                        closestOnSegment(simplex);
+                        break;
+                    case 3:
+                        closestOnTriangle(simplex, 0, 1, 2);
+                        break;
+                    default:
+                        if (!closestOnTetrahedron(simplex)) {
+                            result.overlapping = true;
+                            return result;
+                        }
+                        break;
+                }
+
+                // Rounding can stall the descent; stop at that point
+                const utils::Vec3 next = simplex.closest();
+                const bool stalled = next.dot(next) >= vv;
+                v = next;
+                if (stalled) {
+                    break;
+                }
+            }
+
+            if (!axisSeparates) {
+                result.direction = v * -1.0f;
+            }
+            result.distance = std::sqrt(v.dot(v));
+            for (int i = 0; i < simplex.size; i++) {
+                result.pointA += simplex.points[i].a * simplex.weights[i];
+                result.pointB += simplex.points[i].b * simplex.weights[i];
+            }
+            return result;
+        }
+
+        // Triangle of the EPA polytope, wound outwards
+        struct Face {
+            uint32_t a, b, c;
+            utils::Vec3 normal;
+            float distance;
+        };
+
+        /* Make Face
+        - Builds a face and its plane; degenerate faces are pushed far away
+          so they are never chosen. */
+        Face makeFace(
+            const std::vector<SupportPoint>& vertices,
+            uint32_t a,
+            uint32_t b,
+            uint32_t c
+        ) {
+            Face face{a, b, c, utils::Vec3(), INFINITY};
+            const utils::Vec3 ab = vertices[b].w - vertices[a].w;
+            const utils::Vec3 ac = vertices[c].w - vertices[a].w;
+            const utils::Vec3 normal = ab.cross(ac);
+            const float length = normal.magnitude();
+            if (length > 1e-12f) {
+                face.normal = normal / length;
+                face.distance = face.normal.dot(vertices[a].w);
+            }
+            return face;
+        }
+
+        /* Share Edge
+        - Checks whether two outward-wound faces meet along an edge. */
+        bool shareEdge(const Face& first, const Face& second) {
+            const uint32_t a[3] = {first.a, first.b, first.c};
+            const uint32_t b[3] = {second.a, second.b, second.c};
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    if (a[i] == b[(j + 1) % 3] && a[(i + 1) % 3] == b[j]) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /* Complete Simplex
+        - Grows a GJK simplex that touches the origin into a tetrahedron
+          with volume, as EPA requires.
+        - Returns: False if the difference has no volume. */
+        bool completeSimplex(
+            MinkowskiDifference& difference,
+            std::vector<SupportPoint>& vertices
+        ) {
+            static const utils::Vec3 AXES[3] = {
+                utils::Vec3(1.0f, 0.0f, 0.0f),
+                utils::Vec3(0.0f, 1.0f, 0.0f),
+                utils::Vec3(0.0f, 0.0f, 1.0f)
+            };
+            const float epsilon = 1e-6f;
+
+            auto tryAdd = [&](const utils::Vec3& direction, auto isNew) {
+                for (float sign : {1.0f, -1.0f}) {
+                    const SupportPoint point =
+                        difference.support(direction * sign);
+                    if (isNew(point.w)) {
+                        vertices.push_back(point);
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            if (vertices.size() == 1) {
+                bool added = false;
+                for (const auto& axis : AXES) {
+                    added = tryAdd(axis, [&](const utils::Vec3& w) {
+                        const utils::Vec3 offset = w - vertices[0].w;
+                        return offset.dot(offset) > epsilon;
+                    });
+                    if (added) {
+                        break;
+                    }
+                }
+                if (!added) {
+                    return false;
+                }
+            }
+
+            if (vertices.size() == 2) {
+                const utils::Vec3 line = vertices[1].w - vertices[0].w;
+                const float lengthSquared = line.dot(line);
+                bool added = false;
+                for (const auto& axis : AXES) {
+                    const utils::Vec3 perpendicular = line.cross(axis);
+                    if (perpendicular.dot(perpendicular) < epsilon) {
+                        continue;
+                    }
+                    added = tryAdd(perpendicular, [&](const utils::Vec3& w) {
+                        const utils::Vec3 offset =
+                            (w - vertices[0].w).cross(line);
+                        return offset.dot(offset) > epsilon * lengthSquared;
+                    });
+                    if (added) {
+                        break;
+                    }
+                }
+                if (!added) {
+                    return false;
+                }
+            }
+
+            if (vertices.size() == 3) {
+                const utils::Vec3 ab = vertices[1].w - vertices[0].w;
+                const utils::Vec3 ac = vertices[2].w - vertices[0].w;
+                const utils::Vec3 normal = ab.cross(ac);
+                const float length = normal.magnitude();
+                if (length <= 0.0f) {
+                    return false;
+                }
+                const bool added = tryAdd(normal, [&](const utils::Vec3& w) {
+                    return std::fabs((w - vertices[0].w).dot(normal))
+                        > epsilon * length;
+                });
+                if (!added) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Working storage of EPA. Kept per thread and reused, so contact
+        // tests on the thread pool stop allocating once it has grown.
+        struct EpaBuffers {
+            std::vector<SupportPoint> vertices;
+            std::vector<Face> faces;
+            std::vector<std::pair<uint32_t, uint32_t>> horizon;
+            std::vector<char> visible; // 1 sees the point, 2 is removed
+        };
+
+        thread_local EpaBuffers epaBuffers;
+
+        /* EPA
+        - Expands a polytope inside the Minkowski difference of two
+          overlapping cores until it reaches the face of the difference
+          closest to the origin, which gives the penetration depth and
+          normal.
+        - Parameters:
+            - difference: The support mapping of A - B.
+            - simplex: The final GJK simplex.
+            - contact: Receives the core penetration.
+        - Returns: False if the difference is degenerate. */
+        bool epa(
+            MinkowskiDifference& difference,
+            const Simplex& simplex,
+            Contact& contact
+        ) {
+            EpaBuffers& buffers = epaBuffers;
+            std::vector<SupportPoint>& vertices = buffers.vertices;
+            vertices.assign(simplex.points, simplex.points + simplex.size);
+            if (!completeSimplex(difference, vertices)) {
+                return false;
+            }
+
+            // Wind the initial tetrahedron outwards
+            const utils::Vec3 centroid =
+                (vertices[0].w + vertices[1].w + vertices[2].w + vertices[3].w)
+                * 0.25f;
+            std::vector<Face>& faces = buffers.faces;
+            faces.clear();
+            static constexpr uint32_t TETRAHEDRON[4][3] =
+                {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
+            for (const auto& triangle : TETRAHEDRON) {
+                Face face =
+                    makeFace(vertices, triangle[0], triangle[1], triangle[2]);
+                const utils::Vec3 normal =
+                    (vertices[face.b].w - vertices[face.a].w)
+                        .cross(vertices[face.c].w - vertices[face.a].w);
+                if (normal.dot(vertices[face.a].w - centroid) < 0.0f) {
+                    face = makeFace(
+                        vertices,
+                        triangle[0],
+                        triangle[2],
+                        triangle[1]
+                    );
+                }
+                faces.push_back(face);
+            }
+
+            auto& horizon = buffers.horizon;
+            std::vector<char>& visible = buffers.visible;
+            size_t closest = 0;
+            for (int iteration = 0; iteration < EPA_MAX_ITERATIONS;
+                 iteration++) {
+                closest = 0;
+                for (size_t i = 1; i < faces.size(); i++) {
+                    if (faces[i].distance < faces[closest].distance) {
+                        closest = i;
+                    }
+                }
+
+                // Climb from the face's witnesses, which are close by
+                const Face face = faces[closest];
+                difference.hintA = vertices[face.a].vertexA;
+                difference.hintB = vertices[face.a].vertexB;
+                const SupportPoint point = difference.support(face.normal);
+                const float growth = point.w.dot(face.normal) - face.distance;
+                if (growth <= EPA_TOLERANCE * std::max(1.0f, face.distance)) {
+                    break;
+                }
+
+                // Faces the new point sees, grown from the closest face
+                // across shared edges so the removed region stays connected
+                const float visibility =
+                    EPA_TOLERANCE * 1e-2f * std::max(1.0f, face.distance);
+                visible.assign(faces.size(), 0);
+                visible[closest] = 2;
+                for (size_t i = 0; i < faces.size(); i++) {
+                    const utils::Vec3 offset = point.w - vertices[faces[i].a].w;
+                    if (i != closest
+                        && faces[i].normal.dot(offset) > visibility) {
+                        visible[i] = 1;
+                    }
+                }
+                for (bool grown = true; grown;) {
+                    grown = false;
+                    for (size_t i = 0; i < faces.size(); i++) {
+                        if (visible[i] != 1) {
+                            continue;
+                        }
+                        for (size_t j = 0; j < faces.size(); j++) {
+                            if (visible[j] == 2
+                                && shareEdge(faces[i], faces[j])) {
+                                visible[i] = 2;
+                                grown = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                // Remove them, keeping the boundary of the removed region
+                horizon.clear();
+                const uint32_t index = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(point);
+                size_t kept = 0;
+                for (size_t i = 0; i < faces.size(); i++) {
+                    if (visible[i] != 2) {
+                        faces[kept++] = faces[i];
+                        continue;
+                    }
+
+                    const Face& removed = faces[i];
+                    const uint32_t edges[3][2] = {
+                        {removed.a, removed.b},
+                        {removed.b, removed.c},
+                        {removed.c, removed.a}
+                    };
+                    for (const auto& edge : edges) {
+                        auto twin = std::find(
+                            horizon.begin(),
+                            horizon.end(),
+                            std::make_pair(edge[1], edge[0])
+                        );
+                        if (twin != horizon.end()) {
+                            *twin = horizon.back();
+                            horizon.pop_back();
+                        } else {
+                            horizon.emplace_back(edge[0], edge[1]);
+                        }
+                    }
+                }
+                faces.resize(kept);
+
+                if (horizon.empty()) {
+                    break;
+                }
+                for (const auto& edge : horizon) {
+                    faces.push_back(
+                        makeFace(vertices, edge.first, edge.second, index)
+                    );
+                }
+            }
+
+            // Project the origin onto the closest face for the witnesses
+            closest = 0;
+            for (size_t i = 1; i < faces.size(); i++) {
+                if (faces[i].distance < faces[closest].distance) {
+                    closest = i;
+                }
+            }
+            const Face& face = faces[closest];
+            if (face.distance == INFINITY) {
+                return false;
+            }
+
+            const SupportPoint& a = vertices[face.a];
+            const SupportPoint& b = vertices[face.b];
+            const SupportPoint& c = vertices[face.c];
+            const utils::Vec3 point = face.normal * face.distance;
+            const utils::Vec3 v0 = b.w - a.w;
+            const utils::Vec3 v1 = c.w - a.w;
+            const utils::Vec3 v2 = point - a.w;
+            const float d00 = v0.dot(v0);
+            const float d01 = v0.dot(v1);
+            const float d11 = v1.dot(v1);
+            const float d20 = v2.dot(v0);
+            const float d21 = v2.dot(v1);
+            const float denominator = d00 * d11 - d01 * d01;
+
+            float v = 0.0f;
+            float w = 0.0f;
+            if (denominator != 0.0f) {
+                v = (d11 * d20 - d01 * d21) / denominator;
+                w = (d00 * d21 - d01 * d20) / denominator;
+            }
+            const float u = 1.0f - v - w;
+
+            contact.normal = face.normal;
+            contact.depth = std::max(face.distance, 0.0f);
+            contact.pointA = a.a * u + b.a * v + c.a * w;
+            contact.pointB = a.b * u + b.b * v + c.b * w;
+            return true;
+        }
+    } // namespace
+
+    /* Intersect
+    - Checks whether two shapes overlap, using the analytic test where one
+      exists and GJK otherwise.
+    - Parameters:
+        - a, positionA: The first shape and its position.
+        - b, positionB: The second shape and its position.
+        - cache: Optional per-pair state, read and updated.
+    - Returns: True if the shapes overlap. */
+    bool intersect(
+        const Shape& a,
+        const utils::Vec3& positionA,
+        const Shape& b,
+        const utils::Vec3& positionB,
+        NarrowphaseCache* cache
+    ) {
+        if (a.type != ShapeType::ConvexHull
+            && b.type != ShapeType::ConvexHull) {
+            Contact contact;
+            return collide(a, positionA, b, positionB, contact);
+        }
+
+        NarrowphaseCache local;
+        NarrowphaseCache& state = cache ? *cache : local;
+        MinkowskiDifference difference{
+            a,
+            positionA,
+            b,
+            positionB,
+            state.hintA,
+            state.hintB
+        };
+
+        const float radius = a.getCoreRadius() + b.getCoreRadius();
+        const GjkResult result = gjk(difference, state.direction, radius);
+
+        state.hintA = difference.hintA;
+        state.hintB = difference.hintB;
+        state.direction = result.direction;
+        return result.overlapping || result.distance <= radius;
+    }
+
+    /* Collide
+    - Computes the contact between two shapes, dispatching to an analytic
+      test where one exists and to GJK/EPA otherwise.
+    - Parameters:
+        - a, positionA: The first shape and its position.
+        - b, positionB: The second shape and its position.
+        - contact: Receives the contact, with the normal from A to B.
+        - cache: Optional per-pair state, read and updated.
+    - Returns: True if the shapes overlap. */
+    bool collide(
+        const Shape& a,
+        const utils::Vec3& positionA,
+        const Shape& b,
+        const utils::Vec3& positionB,
+        Contact& contact,
+        NarrowphaseCache* cache
+    ) {
+        if (a.type == ShapeType::Sphere && b.type == ShapeType::Sphere) {
+            return collideSpheres(
+                a.radius,
+                positionA,
+                b.radius,
+                positionB,
+                contact
+            );
+        }
+
+        if (a.type == ShapeType::Sphere && b.type == ShapeType::Box) {
+            return collideSphereBox(
+                a.radius,
+                positionA,
+                b.halfExtents,
+                positionB,
+                contact
+            );
+        }
+
+        if (a.type == ShapeType::Box && b.type == ShapeType::Sphere) {
+            if (!collideSphereBox(
+                    b.radius,
+                    positionB,
+                    a.halfExtents,
+                    positionA,
+                    contact
+                )) {
+                return false;
+            }
+            flip(contact);
+            return true;
+        }
+
+        if (a.type == ShapeType::Box && b.type == ShapeType::Box) {
+            return collideBoxes(
+                a.halfExtents,
+                positionA,
+                b.halfExtents,
+                positionB,
+                contact
+            );
+        }
+
+        return collideConvex(a, positionA, b, positionB, contact, cache);
+    }
+
+    /* Collide Spheres
+    - Analytic sphere/sphere contact.
+    - Returns: True if the spheres overlap. */
+    bool collideSpheres(
+        float radiusA,
+        const utils::Vec3& positionA,
+        float radiusB,
+        const utils::Vec3& positionB,
+        Contact& contact
+    ) {
+        const utils::Vec3 offset = positionB - positionA;
+        const float distanceSquared = offset.dot(offset);
+        const float radius = radiusA + radiusB;
+        if (distanceSquared > radius * radius) {
+            return false;
+        }
+
+        const float distance = std::sqrt(distanceSquared);
+        contact.normal = distance > 0.0f ? offset / distance
+                                         : utils::Vec3(0.0f, 1.0f, 0.0f);
+        contact.depth = radius - distance;
+        contact.pointA = positionA + contact.normal * radiusA;
+        contact.pointB = positionB - contact.normal * radiusB;
+        return true;
+    }
+
+    /* Collide Sphere Box
+    - Analytic contact between a sphere (A) and an axis-aligned box (B),
+      from the point of the box closest to the sphere's center.
+    - Returns: True if the shapes overlap. */
+    bool collideSphereBox(
+        float radius,
+        const utils::Vec3& spherePosition,
+        const utils::Vec3& halfExtents,
+        const utils::Vec3& boxPosition,
+        Contact& contact
+    ) {
+        const utils::Vec3 local = spherePosition - boxPosition;
+        const utils::Vec3 clamped(
+            std::clamp(local.x, -halfExtents.x, halfExtents.x),
+            std::clamp(local.y, -halfExtents.y, halfExtents.y),
+            std::clamp(local.z, -halfExtents.z, halfExtents.z)
+        );
+        const utils::Vec3 offset = local - clamped;
+        const float distanceSquared = offset.dot(offset);
+        if (distanceSquared > radius * radius) {
+            return false;
+        }
+
+        if (distanceSquared > 0.0f) {
+            // Center outside the box: push out along the closest point
+            const float distance = std::sqrt(distanceSquared);
+            contact.normal = offset / -distance;
+            contact.depth = radius - distance;
+            contact.pointA = spherePosition + contact.normal * radius;
+            contact.pointB = boxPosition + clamped;
+            return true;
+        }
+
+        // Center inside the box: push out through the nearest face
+        int axis = 0;
+        float faceDistance = INFINITY;
+        for (int i = 0; i < 3; i++) {
+            const float distance =
+                axisValue(halfExtents, i) - std::fabs(axisValue(local, i));
+            if (distance < faceDistance) {
+                faceDistance = distance;
+                axis = i;
+            }
+        }
+        const float side = axisValue(local, axis) < 0.0f ? -1.0f : 1.0f;
+
+        contact.normal = utils::Vec3();
+        setAxisValue(contact.normal, axis, -side);
+        contact.depth = radius + faceDistance;
+        contact.pointA = spherePosition + contact.normal * radius;
+        contact.pointB = spherePosition;
+        setAxisValue(
+            contact.pointB,
+            axis,
+            axisValue(boxPosition, axis) + side * axisValue(halfExtents, axis)
+        );
+        return true;
+    }
+
+    /* Collide Boxes
+    - Analytic contact between two axis-aligned boxes, separated along the
+      axis of least overlap. The contact points lie at the center of the
+      overlap region, on each box's face.
+    - Returns: True if the boxes overlap. */
+    bool collideBoxes(
+        const utils::Vec3& halfExtentsA,
+        const utils::Vec3& positionA,
+        const utils::Vec3& halfExtentsB,
+        const utils::Vec3& positionB,
+        Contact& contact
+    ) {
+        const utils::Vec3 minA = positionA - halfExtentsA;
+        const utils::Vec3 maxA = positionA + halfExtentsA;
+        const utils::Vec3 minB = positionB - halfExtentsB;
+        const utils::Vec3 maxB = positionB + halfExtentsB;
+
+        int axis = 0;
+        float depth = INFINITY;
+        utils::Vec3 center;
+        for (int i = 0; i < 3; i++) {
+            const float lower =
+                std::max(axisValue(minA, i), axisValue(minB, i));
+            const float upper =
+                std::min(axisValue(maxA, i), axisValue(maxB, i));
+            const float overlap = upper - lower;
+            if (overlap < 0.0f) {
+                return false;
+            }
+            if (overlap < depth) {
+                depth = overlap;
+                axis = i;
+            }
+            setAxisValue(center, i, (lower + upper) * 0.5f);
+        }
+
+        const bool positive =
+            axisValue(positionB, axis) >= axisValue(positionA, axis);
+        contact.normal = utils::Vec3();
+        setAxisValue(contact.normal, axis, positive ? 1.0f : -1.0f);
+        contact.depth = depth;
+        contact.pointA = center;
+        contact.pointB = center;
+        setAxisValue(
+            contact.pointA,
+            axis,
+            positive ? axisValue(maxA, axis) : axisValue(minA, axis)
+        );
+        setAxisValue(
+            contact.pointB,
+            axis,
+            positive ? axisValue(minB, axis) : axisValue(maxB, axis)
+        );
+        return true;
+    }
+
+    /* Collide Convex
+    - GJK/EPA contact between any two convex shapes. GJK measures the
+      distance between the core shapes; if it is below the sum of the
+      sphere radii the contact follows directly, and if the cores overlap
+      EPA finds their penetration.
+    - Parameters:
+        - a, positionA: The first shape and its position.
+        - b, positionB: The second shape and its position.
+        - contact: Receives the contact, with the normal from A to B.
+        - cache: Optional per-pair state, read and updated.
+    - Returns: True if the shapes overlap. */
+    bool collideConvex(
+        const Shape& a,
+        const utils::Vec3& positionA,
+        const Shape& b,
+        const utils::Vec3& positionB,
+        Contact& contact,
+        NarrowphaseCache* cache
+    ) {
+        NarrowphaseCache local;
+        NarrowphaseCache& state = cache ? *cache : local;
+        MinkowskiDifference difference{
+            a,
+            positionA,
+            b,
+            positionB,
+            state.hintA,
+            state.hintB
+        };
+
+        const float radiusA = a.getCoreRadius();
+        const float radiusB = b.getCoreRadius();
+        const GjkResult result =
+            gjk(difference, state.direction, radiusA + radiusB);
+
+        state.direction = result.direction;
+
+        bool hit;
+        if (!result.overlapping) {
+            hit = result.distance <= radiusA + radiusB;
+            if (hit) {
+                contact.normal =
+                    (result.pointB - result.pointA) / result.distance;
+                contact.depth = radiusA + radiusB - result.distance;
+                contact.pointA = result.pointA;
+                contact.pointB = result.pointB;
+            }
+        } else {
+            hit = epa(difference, result.simplex, contact);
+            if (!hit) {
+                // Flat cores: fall back to separating the centers
+                const utils::Vec3 offset = positionB - positionA;
+                const float length = offset.magnitude();
+                contact.normal = length > 0.0f
+                    ? offset / length
+                    : utils::Vec3(0.0f, 1.0f, 0.0f);
+                contact.depth = 0.0f;
+                contact.pointA = positionA;
+                contact.pointB = positionA;
+                hit = true;
+            }
+            contact.depth += radiusA + radiusB;
+        }
+
+        if (hit) {
+            contact.pointA += contact.normal * radiusA;
+            contact.pointB -= contact.normal * radiusB;
+        }
+        state.hintA = difference.hintA;
+        state.hintB = difference.hintB;
+        return hit;
+    }
+}; // namespace omelette::physics::Narrowphase
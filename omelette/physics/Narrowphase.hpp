@@ -0,0 +1,94 @@
+#ifndef OMELETTE_PHYSICS_NARROWPHASE_HPP
+#define OMELETTE_PHYSICS_NARROWPHASE_HPP
+
+#include <cstdint>
+
+#include "../ecs/Entity.hpp"
+#include "../utils/Vec3.hpp"
+#include "Shape.hpp"
+
+namespace omelette::physics {
+    // Penetration of shape A into shape B
+    struct Contact {
+        utils::Vec3 normal; // Unit direction from A towards B
+        float depth = 0.0f; // Penetration distance along the normal
+        utils::Vec3 pointA; // Deepest point of A inside B, world space
+        utils::Vec3 pointB; // Deepest point of B inside A, world space
+    };
+
+    // Contact between two entities, ordered so that a < b
+    struct ContactPair {
+        omelette::ecs::Entity a;
+        omelette::ecs::Entity b;
+        Contact contact;
+    };
+
+    // Per-pair state kept between frames to warm-start queries: the hull
+    // vertices last returned by hill climbing and the last GJK direction
+    struct NarrowphaseCache {
+        uint32_t hintA = 0;
+        uint32_t hintB = 0;
+        utils::Vec3 direction;
+    };
+
+    // Exact convex collision tests. Sphere/sphere, sphere/box and box/box
+    // are solved analytically; every other pair runs GJK on the core
+    // shapes (spheres shrink to points) and EPA when the cores overlap.
+    namespace Narrowphase {
+        // Check whether two shapes overlap
+        bool intersect(
+            const Shape& a,
+            const utils::Vec3& positionA,
+            const Shape& b,
+            const utils::Vec3& positionB,
+            NarrowphaseCache* cache = nullptr
+        );
+
+        // Compute the contact between two shapes; false if they are apart
+        bool collide(
+            const Shape& a,
+            const utils::Vec3& positionA,
+            const Shape& b,
+            const utils::Vec3& positionB,
+            Contact& contact,
+            NarrowphaseCache* cache = nullptr
+        );
+
+        // Analytic tests, also used by collide
+        bool collideSpheres(
+            float radiusA,
+            const utils::Vec3& positionA,
+            float radiusB,
+            const utils::Vec3& positionB,
+            Contact& contact
+        );
+
+        bool collideSphereBox(
+            float radius,
+            const utils::Vec3& spherePosition,
+            const utils::Vec3& halfExtents,
+            const utils::Vec3& boxPosition,
+            Contact& contact
+        );
+
+        bool collideBoxes(
+            const utils::Vec3& halfExtentsA,
+            const utils::Vec3& positionA,
+            const utils::Vec3& halfExtentsB,
+            const utils::Vec3& positionB,
+            Contact& contact
+        );
+
+        // GJK/EPA test for any pair of convex shapes
+        bool collideConvex(
+            const Shape& a,
+            const utils::Vec3& positionA,
+            const Shape& b,
+            const utils::Vec3& positionB,
+            Contact& contact,
+            NarrowphaseCache* cache = nullptr
+        );
+    }; // namespace Narrowphase
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_NARROWPHASE_HPP
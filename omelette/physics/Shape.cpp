@@ -0,0 +1,100 @@
+#include "Shape.hpp"
+
+#include <utility>
+
+namespace omelette::physics {
+    /* Shape Constructor
+    - Creates an empty shape of a type; use the factories instead. */
+    Shape::Shape(ShapeType type) : type(type) {}
+
+    /* Sphere
+    - Returns: A sphere of the given radius, with closed-form bounds and
+      mass properties. */
+    Shape Shape::sphere(float radius) {
+        Shape shape(ShapeType::Sphere);
+        shape.radius = radius;
+        shape.bounds = utils::AABB(
+            utils::Vec3(-radius, -radius, -radius),
+            utils::Vec3(radius, radius, radius)
+        );
+        shape.boundingSphere = utils::BoundingSphere(utils::Vec3(), radius);
+        shape.massProperties = utils::MassProperties::sphere(radius);
+        return shape;
+    }
+
+    /* Box
+    - Returns: An axis-aligned box with the given half extents, with
+      closed-form bounds and mass properties. */
+    Shape Shape::box(const utils::Vec3& halfExtents) {
+        Shape shape(ShapeType::Box);
+        shape.halfExtents = halfExtents;
+        shape.bounds = utils::AABB(halfExtents * -1.0f, halfExtents);
+        shape.boundingSphere =
+            utils::BoundingSphere(utils::Vec3(), halfExtents.magnitude());
+        shape.massProperties = utils::MassProperties::box(halfExtents);
+        return shape;
+    }
+
+    /* Convex Hull
+    - Returns: A shape wrapping a hull, which may be shared between shapes.
+      The bounds and mass properties are the ones the hull computed when
+      it was built. */
+    Shape Shape::convexHull(std::shared_ptr<const ConvexHull> hull) {
+        Shape shape(ShapeType::ConvexHull);
+        shape.bounds = hull->getBounds();
+        shape.boundingSphere =
+            utils::BoundingSphere::fromPoints(hull->getVertices());
+        shape.massProperties = hull->getMassProperties();
+        shape.hull = std::move(hull);
+        return shape;
+    }
+
+    /* Support
+    - Finds the point of the shape furthest along a direction.
+    - Parameters:
+        - direction: The search direction (need not be normalized).
+        - hint: Hull vertex to start from; receives the support vertex.
+    - Returns: The support point, in shape space. */
+    utils::Vec3
+    Shape::support(const utils::Vec3& direction, uint32_t& hint) const {
+        if (type == ShapeType::Sphere) {
+            const float length = direction.magnitude();
+            if (length <= 0.0f) {
+                return utils::Vec3(radius, 0.0f, 0.0f);
+            }
+            return direction * (radius / length);
+        }
+        return coreSupport(direction, hint);
+    }
+
+    /* Get Core Radius
+    - Returns: The sphere radius, or zero for shapes with sharp edges. */
+    float Shape::getCoreRadius() const {
+        return type == ShapeType::Sphere ? radius : 0.0f;
+    }
+
+    /* Core Support
+    - Like support, but spheres collapse to their center point. GJK and EPA
+      run on cores so that round shapes converge exactly.
+    - Parameters:
+        - direction: The search direction (need not be normalized).
+        - hint: Hull vertex to start from; receives the support vertex.
+    - Returns: The core support point, in shape space. */
+    utils::Vec3
+    Shape::coreSupport(const utils::Vec3& direction, uint32_t& hint) const {
+        switch (type) {
+            case ShapeType::Box:
+                return utils::Vec3(
+                    direction.x < 0.0f ? -halfExtents.x : halfExtents.x,
+                    direction.y < 0.0f ? -halfExtents.y : halfExtents.y,
+                    direction.z < 0.0f ? -halfExtents.z : halfExtents.z
+                );
+            case ShapeType::ConvexHull:
+                hint = hull->support(direction, hint);
+                return hull->getVertex(hint);
+            case ShapeType::Sphere:
+            default:
+                return utils::Vec3();
+        }
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,54 @@
+#ifndef OMELETTE_PHYSICS_SHAPE_HPP
+#define OMELETTE_PHYSICS_SHAPE_HPP
+
+#include <cstdint>
+#include <memory>
+
+#include "../utils/AABB.hpp"
+#include "../utils/BoundingSphere.hpp"
+#include "../utils/MassProperties.hpp"
+#include "../utils/Vec3.hpp"
+#include "ConvexHull.hpp"
+
+namespace omelette::physics {
+    // Kinds of convex collision shape
+    enum class ShapeType { Sphere, Box, ConvexHull };
+
+    // Convex collision shape centered on its body's position. Bodies have
+    // no orientation, so boxes are axis-aligned.
+    class Shape {
+      public:
+        ShapeType type;
+        float radius = 0.0f; // Sphere radius
+        utils::Vec3 halfExtents; // Box half extents
+        std::shared_ptr<const ConvexHull> hull; // Shared hull data
+
+        // Derived by the factories, so collision and inertia code never
+        // recomputes them: bounds in shape space and the mass properties
+        // of the solid shape
+        utils::AABB bounds;
+        utils::BoundingSphere boundingSphere;
+        utils::MassProperties massProperties;
+
+        // Factories
+        static Shape sphere(float radius);
+        static Shape box(const utils::Vec3& halfExtents);
+        static Shape convexHull(std::shared_ptr<const ConvexHull> hull);
+
+        // Point furthest along a direction, in shape space. For hulls, hint
+        // is the vertex to start climbing from and receives the result.
+        utils::Vec3 support(const utils::Vec3& direction, uint32_t& hint) const;
+
+        // Radius spheres are treated as: a point core grown by this much
+        float getCoreRadius() const;
+
+        // Support point of the core shape, which excludes that radius
+        utils::Vec3
+        coreSupport(const utils::Vec3& direction, uint32_t& hint) const;
+
+      private:
+        explicit Shape(ShapeType type);
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_SHAPE_HPP
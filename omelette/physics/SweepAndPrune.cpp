@@ -0,0 +1,198 @@
+#include "SweepAndPrune.hpp"
+
+#include <algorithm>
+
+namespace omelette::physics {
+    namespace {
+        // Component of a vector along an axis
+        float axisValue(const utils::Vec3& v, int axis) {
+            return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+        }
+    } // namespace
+
+    /* SweepAndPrune Constructor
+    - Creates an empty broadphase.
+    - Parameters:
+        - margin: Distance the fat AABBs extend past the tight ones. */
+    SweepAndPrune::SweepAndPrune(float margin) : Broadphase(margin) {}
+
+    /* Create Proxy
+    - Registers an entity's fattened AABB. It is sorted into place by the
+      next computePairs call.
+    - Parameters:
+        - aabb: The entity's tight AABB.
+        - entity: The entity owning the proxy.
+    - Returns: The proxy handle. */
+    ProxyId SweepAndPrune::createProxy(
+        const utils::AABB& aabb,
+        omelette::ecs::Entity entity
+    ) {
+        ProxyId proxy;
+        if (!freeProxies.empty()) {
+            proxy = freeProxies.back();
+            freeProxies.pop_back();
+        } else {
+            proxy = static_cast<ProxyId>(proxies.size());
+            proxies.emplace_back();
+        }
+
+        // A recycled handle may still be in the order, awaiting its purge
+        Proxy& slot = proxies[proxy];
+        slot.aabb = fatten(aabb, utils::Vec3());
+        slot.entity = entity;
+        slot.active = true;
+        if (!slot.inOrder) {
+            slot.inOrder = true;
+            order.push_back(proxy);
+        }
+        return proxy;
+    }
+
+    /* Destroy Proxy
+    - Unregisters a proxy. It is purged from the sweep order lazily.
+    - Parameters:
+        - proxy: The proxy handle. */
+    void SweepAndPrune::destroyProxy(ProxyId proxy) {
+        proxies[proxy].active = false;
+        freeProxies.push_back(proxy);
+        hasDestroyed = true;
+    }
+
+    /* Move Proxy
+    - Updates a proxy's fat AABB if its tight AABB escaped it.
+    - Parameters:
+        - proxy: The proxy handle.
+        - aabb: The new tight AABB.
+        - displacement: The expected motion until the next update.
+    - Returns: True if the fat AABB was rebuilt. */
+    bool SweepAndPrune::moveProxy(
+        ProxyId proxy,
+        const utils::AABB& aabb,
+        const utils::Vec3& displacement
+    ) {
+        if (proxies[proxy].aabb.contains(aabb)) {
+            return false;
+        }
+        proxies[proxy].aabb = fatten(aabb, displacement);
+        return true;
+    }
+
+    /* Get Fat AABB
+    - Returns: The fat AABB stored for a proxy. */
+    const utils::AABB& SweepAndPrune::getFatAABB(ProxyId proxy) const {
+        return proxies[proxy].aabb;
+    }
+
+    /* Get Proxy Count
+    - Returns: The number of live proxies. */
+    size_t SweepAndPrune::getProxyCount() const {
+        return proxies.size() - freeProxies.size();
+    }
+
+    /* Choose Axis
+    - Returns the axis along which the proxy centers vary the most, which
+      minimizes the number of intervals overlapping during the sweep. */
+    int SweepAndPrune::chooseAxis() const {
+        if (order.size() < 2) {
+            return axis;
+        }
+
+        utils::Vec3 sum;
+        utils::Vec3 sumSquares;
+        for (ProxyId proxy : order) {
+            const utils::Vec3 center = proxies[proxy].aabb.center();
+            sum += center;
+            sumSquares += utils::Vec3(
+                center.x * center.x,
+                center.y * center.y,
+                center.z * center.z
+            );
+        }
+
+        const float inverseCount = 1.0f / static_cast<float>(order.size());
+        const utils::Vec3 mean = sum * inverseCount;
+        const utils::Vec3 variance = utils::Vec3(
+            sumSquares.x * inverseCount - mean.x * mean.x,
+            sumSquares.y * inverseCount - mean.y * mean.y,
+            sumSquares.z * inverseCount - mean.z * mean.z
+        );
+
+        if (variance.x >= variance.y && variance.x >= variance.z) {
+            return 0;
+        }
+        return variance.y >= variance.z ? 1 : 2;
+    }
+
+    /* Compute Pairs
+    - Restores the sort order, then sweeps: each proxy is tested against the
+      following proxies until their minimum passes its maximum on the axis.
+      Each pair is visited once, so the output holds no duplicates.
+    - Parameters:
+        - pairs: Replaced with the overlapping pairs, sorted. */
+    void SweepAndPrune::computePairs(std::vector<BroadphasePair>& pairs) {
+        pairs.clear();
+
+        if (hasDestroyed) {
+            order.erase(
+                std::remove_if(
+                    order.begin(),
+                    order.end(),
+                    [this](ProxyId proxy) {
+                        if (proxies[proxy].active) {
+                            return false;
+                        }
+                        proxies[proxy].inOrder = false;
+                        return true;
+                    }
+                ),
+                order.end()
+            );
+            hasDestroyed = false;
+        }
+
+        auto minimum = [this](ProxyId proxy) {
+            return axisValue(proxies[proxy].aabb.min, axis);
+        };
+
+        const int bestAxis = chooseAxis();
+        if (bestAxis != axis) {
+            // Order on a new axis is unrelated to the old one
+            axis = bestAxis;
+            std::sort(order.begin(), order.end(), [&](ProxyId a, ProxyId b) {
+                return minimum(a) < minimum(b);
+            });
+        } else {
+            // Insertion sort: near O(n) for coherent motion
+            for (size_t i = 1; i < order.size(); i++) {
+                const ProxyId proxy = order[i];
+                const float key = minimum(proxy);
+                size_t j = i;
+                while (j > 0 && minimum(order[j - 1]) > key) {
+                    order[j] = order[j - 1];
+                    j--;
+                }
+                order[j] = proxy;
+            }
+        }
+
+        for (size_t i = 0; i < order.size(); i++) {
+            const Proxy& proxy = proxies[order[i]];
+            const float maximum = axisValue(proxy.aabb.max, axis);
+
+            for (size_t j = i + 1; j < order.size(); j++) {
+                const Proxy& other = proxies[order[j]];
+                if (axisValue(other.aabb.min, axis) > maximum) {
+                    break;
+                }
+                if (proxy.aabb.overlaps(other.aabb)) {
+                    pairs.push_back(
+                        proxy.entity < other.entity
+                            ? BroadphasePair{proxy.entity, other.entity}
+                            : BroadphasePair{other.entity, proxy.entity}
+                    );
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+    }
+}; // namespace omelette::physics
@@ -0,0 +1,65 @@
+#ifndef OMELETTE_PHYSICS_SWEEPANDPRUNE_HPP
+#define OMELETTE_PHYSICS_SWEEPANDPRUNE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "Broadphase.hpp"
+
+namespace omelette::physics {
+    // Sort-and-sweep broadphase. Proxies are kept sorted by the minimum of
+    // their fat AABB along the axis where the proxies are most spread out.
+    // Frame-to-frame coherence keeps the order nearly sorted, so the
+    // insertion sort that maintains it runs in close to linear time.
+    class SweepAndPrune: public Broadphase {
+      private:
+        struct Proxy {
+            utils::AABB aabb; // Fat AABB
+            omelette::ecs::Entity entity; // Owning entity
+            bool active = false; // False once destroyed
+            bool inOrder = false; // Whether the handle is in the sweep order
+        };
+
+        // Proxy pool, indexed by proxy handle
+        std::vector<Proxy> proxies;
+
+        // Destroyed proxy handles available for reuse
+        std::vector<ProxyId> freeProxies;
+
+        // Active proxies sorted by fat AABB minimum on the sweep axis
+        std::vector<ProxyId> order;
+
+        // Axis the order is sorted on (0 = x, 1 = y, 2 = z)
+        int axis = 0;
+
+        // Whether destroyed proxies must be purged from the order
+        bool hasDestroyed = false;
+
+        // Pick the axis with the largest variance of proxy centers
+        int chooseAxis() const;
+
+      public:
+        explicit SweepAndPrune(float margin = 0.1f);
+
+        ProxyId createProxy(
+            const utils::AABB& aabb,
+            omelette::ecs::Entity entity
+        ) override;
+
+        void destroyProxy(ProxyId proxy) override;
+
+        bool moveProxy(
+            ProxyId proxy,
+            const utils::AABB& aabb,
+            const utils::Vec3& displacement
+        ) override;
+
+        const utils::AABB& getFatAABB(ProxyId proxy) const override;
+
+        size_t getProxyCount() const override;
+
+        void computePairs(std::vector<BroadphasePair>& pairs) override;
+    };
+}; // namespace omelette::physics
+
+#endif // OMELETTE_PHYSICS_SWEEPANDPRUNE_HPP
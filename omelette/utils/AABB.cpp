@@ -0,0 +1,101 @@
+#include "AABB.hpp"
+
+#include <algorithm>
+
+namespace omelette::utils {
+    /* AABB Default Constructor
+    - Creates an empty box at the origin. */
+    AABB::AABB() : min(), max() {}
+
+    /* AABB Constructor
+    - Creates a box from its minimum and maximum corners. */
+    AABB::AABB(const Vec3& min, const Vec3& max) : min(min), max(max) {}
+
+    /* AABB From Points
+    - Returns the smallest box containing every point, or an empty box at
+      the origin if there are none. */
+    AABB AABB::fromPoints(const std::vector<Vec3>& points) {
+        if (points.empty()) {
+            return AABB();
+        }
+
+        Vec3 lower = points[0];
+        Vec3 upper = points[0];
+        for (const auto& point : points) {
+            lower.x = std::min(lower.x, point.x);
+            lower.y = std::min(lower.y, point.y);
+            lower.z = std::min(lower.z, point.z);
+            upper.x = std::max(upper.x, point.x);
+            upper.y = std::max(upper.y, point.y);
+            upper.z = std::max(upper.z, point.z);
+        }
+        return AABB(lower, upper);
+    }
+
+    /* AABB Merge
+    - Returns the smallest box containing both boxes. */
+    AABB AABB::merge(const AABB& a, const AABB& b) {
+        return AABB(
+            Vec3(
+                std::min(a.min.x, b.min.x),
+                std::min(a.min.y, b.min.y),
+                std::min(a.min.z, b.min.z)
+            ),
+            Vec3(
+                std::max(a.max.x, b.max.x),
+                std::max(a.max.y, b.max.y),
+                std::max(a.max.z, b.max.z)
+            )
+        );
+    }
+
+    /* AABB Expanded
+    - Returns the box grown by a margin on every side. */
+    AABB AABB::expanded(float margin) const {
+        const Vec3 grow(margin, margin, margin);
+        return AABB(min - grow, max + grow);
+    }
+
+    /* AABB Extended
+    - Returns the box grown towards a displacement, so it also covers the
+      box moved by that displacement. */
+    AABB AABB::extended(const Vec3& displacement) const {
+        AABB result = *this;
+        (displacement.x < 0 ? result.min.x : result.max.x) += displacement.x;
+        (displacement.y < 0 ? result.min.y : result.max.y) += displacement.y;
+        (displacement.z < 0 ? result.min.z : result.max.z) += displacement.z;
+        return result;
+    }
+
+    /* AABB Translated
+    - Returns the box moved by an offset. */
+    AABB AABB::translated(const Vec3& offset) const {
+        return AABB(min + offset, max + offset);
+    }
+
+    /* AABB Center
+    - Returns the center of the box. */
+    Vec3 AABB::center() const {
+        return (min + max) * 0.5f;
+    }
+
+    /* AABB Extents
+    - Returns half the size of the box along each axis. */
+    Vec3 AABB::extents() const {
+        return (max - min) * 0.5f;
+    }
+
+    /* AABB Perimeter
+    - Returns the sum of the box's twelve edge lengths. */
+    float AABB::perimeter() const {
+        const Vec3 size = max - min;
+        return 4.0f * (size.x + size.y + size.z);
+    }
+
+    /* AABB Surface Area
+    - Returns the surface area of the box. */
+    float AABB::surfaceArea() const {
+        const Vec3 size = max - min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+}; // namespace omelette::utils
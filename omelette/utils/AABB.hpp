@@ -0,0 +1,72 @@
+#ifndef OMELETTE_UTILS_AABB_HPP
+#define OMELETTE_UTILS_AABB_HPP
+
+#include <vector>
+
+#include "Vec3.hpp"
+
+namespace omelette::utils {
+    class AABB {
+      public:
+        Vec3 min; // Minimum corner of the box
+        Vec3 max; // Maximum corner of the box
+
+        // Default constructor (empty box at the origin)
+        AABB();
+
+        // Parameterized constructor
+        AABB(const Vec3& min, const Vec3& max);
+
+        // Smallest box containing a set of points
+        static AABB fromPoints(const std::vector<Vec3>& points);
+
+        // Smallest box containing two boxes
+        static AABB merge(const AABB& a, const AABB& b);
+
+        // Check whether two boxes overlap (touching counts)
+        bool overlaps(const AABB& other) const;
+
+        // Check whether a box lies entirely inside this one
+        bool contains(const AABB& other) const;
+
+        // Box grown by a margin on every side
+        AABB expanded(float margin) const;
+
+        // Box grown in the direction of a displacement
+        AABB extended(const Vec3& displacement) const;
+
+        // Box moved by an offset
+        AABB translated(const Vec3& offset) const;
+
+        // Center of the box
+        Vec3 center() const;
+
+        // Half the size of the box along each axis
+        Vec3 extents() const;
+
+        // Sum of the edge lengths, used as an insertion cost metric
+        float perimeter() const;
+
+        // Surface area of the box
+        float surfaceArea() const;
+    };
+
+    /* AABB Overlaps
+    - Checks whether two boxes overlap. Touching boxes overlap.
+    - Defined inline: broadphase loops call it for every candidate pair. */
+    inline bool AABB::overlaps(const AABB& other) const {
+        return min.x <= other.max.x && max.x >= other.min.x
+            && min.y <= other.max.y && max.y >= other.min.y
+            && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    /* AABB Contains
+    - Checks whether a box lies entirely inside this one. */
+    inline bool AABB::contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y
+            && min.z <= other.min.z && other.max.x <= max.x
+            && other.max.y <= max.y && other.max.z <= max.z;
+    }
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_AABB_HPP
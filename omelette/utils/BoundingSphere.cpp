@@ -0,0 +1,47 @@
+#include "BoundingSphere.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "AABB.hpp"
+
+namespace omelette::utils {
+    /* BoundingSphere Default Constructor
+    - Creates a sphere of radius 0 at the origin. */
+    BoundingSphere::BoundingSphere() : center(), radius(0.0f) {}
+
+    /* BoundingSphere Constructor
+    - Creates a sphere from its center and radius. */
+    BoundingSphere::BoundingSphere(const Vec3& center, float radius) :
+        center(center),
+        radius(radius) {}
+
+    /* BoundingSphere From Points
+    - Returns a sphere around the center of the points' bounds that
+      reaches the furthest point. This is the smallest sphere for the
+      symmetric primitives from utils::Shapes and close to it otherwise.
+      An empty set gives a point sphere at the origin. */
+    BoundingSphere BoundingSphere::fromPoints(const std::vector<Vec3>& points) {
+        const Vec3 center = AABB::fromPoints(points).center();
+        float radiusSquared = 0.0f;
+        for (const auto& point : points) {
+            const Vec3 offset = point - center;
+            radiusSquared = std::max(radiusSquared, offset.dot(offset));
+        }
+        return BoundingSphere(center, std::sqrt(radiusSquared));
+    }
+
+    /* BoundingSphere Overlaps
+    - Checks whether two spheres overlap. Touching spheres overlap. */
+    bool BoundingSphere::overlaps(const BoundingSphere& other) const {
+        const Vec3 offset = other.center - center;
+        const float reach = radius + other.radius;
+        return offset.dot(offset) <= reach * reach;
+    }
+
+    /* BoundingSphere Translated
+    - Returns the sphere moved by an offset. */
+    BoundingSphere BoundingSphere::translated(const Vec3& offset) const {
+        return BoundingSphere(center + offset, radius);
+    }
+}; // namespace omelette::utils
@@ -0,0 +1,31 @@
+#ifndef OMELETTE_UTILS_BOUNDINGSPHERE_HPP
+#define OMELETTE_UTILS_BOUNDINGSPHERE_HPP
+
+#include <vector>
+
+#include "Vec3.hpp"
+
+namespace omelette::utils {
+    class BoundingSphere {
+      public:
+        Vec3 center; // Center of the sphere
+        float radius; // Radius of the sphere
+
+        // Default constructor (point sphere at the origin)
+        BoundingSphere();
+
+        // Parameterized constructor
+        BoundingSphere(const Vec3& center, float radius);
+
+        // Sphere containing a set of points, centered on their bounds
+        static BoundingSphere fromPoints(const std::vector<Vec3>& points);
+
+        // Check whether two spheres overlap (touching counts)
+        bool overlaps(const BoundingSphere& other) const;
+
+        // Sphere moved by an offset
+        BoundingSphere translated(const Vec3& offset) const;
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_BOUNDINGSPHERE_HPP
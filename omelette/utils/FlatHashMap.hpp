@@ -0,0 +1,227 @@
+#ifndef OMELETTE_UTILS_FLATHASHMAP_HPP
+#define OMELETTE_UTILS_FLATHASHMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace omelette::utils {
+    // Open-addressing hash map storing its entries in one flat array, with
+    // linear probing and backward-shift deletion so no tombstones build up.
+    // Unlike std::unordered_map, inserting and erasing do not allocate a
+    // node per entry: once reserve() or past growth has sized the table,
+    // pairs can come and go every step without calling malloc.
+    //
+    // Key and Value must be default-constructible and movable. Pointers to
+    // values stay valid until an insertion grows the table or an erase.
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class FlatHashMap {
+      private:
+        struct Slot {
+            Key key{};
+            Value value{};
+            bool occupied = false;
+        };
+
+        static constexpr size_t MIN_CAPACITY = 16;
+
+        std::vector<Slot> slots;
+        size_t count = 0;
+        size_t mask = 0; // Capacity - 1; the capacity is a power of two
+        unsigned int shift = 64; // 64 - log2(capacity)
+
+        // Home slot of a key. std::hash is often the identity, so the hash
+        // is spread with a Fibonacci multiply and its top bits are kept.
+        size_t homeOf(const Key& key) const {
+            const uint64_t hash = static_cast<uint64_t>(Hash()(key));
+            return static_cast<size_t>(
+                (hash * UINT64_C(0x9E3779B97F4A7C15)) >> shift
+            );
+        }
+
+        // Slot holding a key, or the empty slot ending its probe sequence
+        size_t probe(const Key& key) const {
+            size_t index = homeOf(key);
+            while (slots[index].occupied && !(slots[index].key == key)) {
+                index = (index + 1) & mask;
+            }
+            return index;
+        }
+
+        // Move every entry into a table of the given power-of-two capacity
+        void rehash(size_t capacity) {
+            std::vector<Slot> previous(capacity);
+            previous.swap(slots);
+            mask = capacity - 1;
+            shift = 64;
+            for (size_t size = capacity; size > 1; size >>= 1) {
+                shift--;
+            }
+            for (auto& slot : previous) {
+                if (slot.occupied) {
+                    Slot& target = slots[probe(slot.key)];
+                    target.key = std::move(slot.key);
+                    target.value = std::move(slot.value);
+                    target.occupied = true;
+                }
+            }
+        }
+
+        // Empty a slot, shifting later entries of its cluster back so
+        // every probe sequence stays unbroken
+        void eraseSlot(size_t hole) {
+            size_t next = (hole + 1) & mask;
+            while (slots[next].occupied) {
+                const size_t home = homeOf(slots[next].key);
+                // Move the entry unless its home lies after the hole
+                if (((next - home) & mask) >= ((next - hole) & mask)) {
+                    slots[hole].key = std::move(slots[next].key);
+                    slots[hole].value = std::move(slots[next].value);
+                    hole = next;
+                }
+                next = (next + 1) & mask;
+            }
+            slots[hole] = Slot();
+            count--;
+        }
+
+      public:
+        FlatHashMap() = default;
+
+        // Value of a key, inserting a default-constructed one if missing
+        Value& operator[](const Key& key) {
+            if ((count + 1) * 2 > slots.size()) {
+                rehash(slots.empty() ? MIN_CAPACITY : slots.size() * 2);
+            }
+            Slot& slot = slots[probe(key)];
+            if (!slot.occupied) {
+                slot.key = key;
+                slot.occupied = true;
+                count++;
+            }
+            return slot.value;
+        }
+
+        // Value of a key, or nullptr
+        Value* find(const Key& key) {
+            if (count == 0) {
+                return nullptr;
+            }
+            Slot& slot = slots[probe(key)];
+            return slot.occupied ? &slot.value : nullptr;
+        }
+
+        const Value* find(const Key& key) const {
+            if (count == 0) {
+                return nullptr;
+            }
+            const Slot& slot = slots[probe(key)];
+            return slot.occupied ? &slot.value : nullptr;
+        }
+
+        // Remove a key; returns false if it was missing
+        bool erase(const Key& key) {
+            if (count == 0) {
+                return false;
+            }
+            const size_t index = probe(key);
+            if (!slots[index].occupied) {
+                return false;
+            }
+            eraseSlot(index);
+            return true;
+        }
+
+        /* Erase If
+        - Removes every entry for which predicate(key, value) is true. Each
+          entry is visited exactly once, so the predicate may also update
+          the entries it keeps.
+        - Parameters:
+            - predicate: Called as predicate(const Key&, Value&).
+        - Returns: The number of entries removed. */
+        template<typename Predicate>
+        size_t eraseIf(Predicate&& predicate) {
+            if (count == 0) {
+                return 0;
+            }
+
+            // Start after an empty slot: entries only ever shift backwards
+            // into the hole being filled, so no cluster wraps past the
+            // start and no visited entry moves ahead of the cursor
+            size_t start = 0;
+            while (slots[start].occupied) {
+                start++;
+            }
+
+            size_t removed = 0;
+            size_t index = (start + 1) & mask;
+            while (index != start) {
+                Slot& slot = slots[index];
+                if (slot.occupied && predicate(slot.key, slot.value)) {
+                    // A later entry may shift into this slot: check it again
+                    eraseSlot(index);
+                    removed++;
+                    continue;
+                }
+                index = (index + 1) & mask;
+            }
+            return removed;
+        }
+
+        // Visit every entry as function(const Key&, Value&), in table order
+        template<typename Function>
+        void forEach(Function&& function) {
+            for (auto& slot : slots) {
+                if (slot.occupied) {
+                    function(slot.key, slot.value);
+                }
+            }
+        }
+
+        template<typename Function>
+        void forEach(Function&& function) const {
+            for (const auto& slot : slots) {
+                if (slot.occupied) {
+                    function(slot.key, slot.value);
+                }
+            }
+        }
+
+        // Size the table so size entries fit without growing it
+        void reserve(size_t size) {
+            size_t capacity = slots.empty() ? MIN_CAPACITY : slots.size();
+            while (size * 2 > capacity) {
+                capacity *= 2;
+            }
+            if (capacity != slots.size()) {
+                rehash(capacity);
+            }
+        }
+
+        // Remove every entry, keeping the table
+        void clear() {
+            for (auto& slot : slots) {
+                slot = Slot();
+            }
+            count = 0;
+        }
+
+        // Number of entries
+        size_t size() const {
+            return count;
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        // Number of slots in the table
+        size_t capacity() const {
+            return slots.size();
+        }
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_FLATHASHMAP_HPP
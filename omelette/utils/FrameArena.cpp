@@ -0,0 +1,149 @@
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace omelette::utils {
+    namespace {
+        // Alignment of the block itself; covers every fundamental type
+        constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+    } // namespace
+
+    /* FrameArena Constructor
+    - Parameters:
+        - initialCapacity: Size of the first block, in bytes.
+        - upstream: Where the block and overflowing requests come from. */
+    FrameArena::FrameArena(
+        size_t initialCapacity,
+        std::pmr::memory_resource* upstream
+    ) :
+        upstream(upstream) {
+        allocateBlock(initialCapacity);
+    }
+
+    /* FrameArena Destructor
+    - Returns the block and any overflow to the upstream resource. */
+    FrameArena::~FrameArena() {
+        reset();
+        allocateBlock(0);
+    }
+
+    /* Allocate Block
+    - Frees the current block and allocates one of the given size.
+    - Parameters:
+        - size: The new block size in bytes; zero leaves no block. */
+    void FrameArena::allocateBlock(size_t size) {
+        if (block) {
+            upstream->deallocate(block, capacity, BLOCK_ALIGNMENT);
+            block = nullptr;
+        }
+        capacity = size;
+        if (size > 0) {
+            block = static_cast<std::byte*>(
+                upstream->allocate(size, BLOCK_ALIGNMENT)
+            );
+        }
+    }
+
+    /* Reset
+    - Makes the whole block available again. If requests overflowed since
+      the last reset, the overflow is freed and the block regrown to hold
+      everything that was used, so the next step of the same size fits.
+      Otherwise this only rewinds an offset. */
+    void FrameArena::reset() {
+        const size_t used = getUsed();
+        if (used > highWaterMark) {
+            highWaterMark = used;
+        }
+
+        if (!overflows.empty()) {
+            for (const auto& overflow : overflows) {
+                upstream->deallocate(
+                    overflow.pointer,
+                    overflow.bytes,
+                    overflow.alignment
+                );
+            }
+            overflows.clear();
+            overflowBytes = 0;
+
+            // Leave headroom for alignment padding and growth
+            allocateBlock(highWaterMark + highWaterMark / 2);
+        }
+        offset.store(0, std::memory_order_relaxed);
+    }
+
+    /* Do Allocate
+    - Bumps the offset past an aligned range of the block, or allocates
+      upstream if the block is full.
+    - Parameters:
+        - bytes: The size of the allocation.
+        - alignment: The required alignment, a power of two.
+    - Returns: The allocated memory. */
+    void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+        const auto base = reinterpret_cast<uintptr_t>(block);
+        size_t current = offset.load(std::memory_order_relaxed);
+        while (true) {
+            const uintptr_t address =
+                (base + current + alignment - 1) & ~uintptr_t(alignment - 1);
+            const size_t begin = address - base;
+            if (begin + bytes > capacity) {
+                break;
+            }
+            if (offset.compare_exchange_weak(
+                    current,
+                    begin + bytes,
+                    std::memory_order_relaxed
+                )) {
+                return block + begin;
+            }
+        }
+
+        void* pointer = upstream->allocate(bytes, alignment);
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        overflows.push_back({pointer, bytes, alignment});
+        overflowBytes += bytes;
+        return pointer;
+    }
+
+    /* Do Deallocate
+    - Does nothing: memory is reclaimed by reset(). */
+    void FrameArena::do_deallocate(void*, size_t, size_t) {}
+
+    /* Do Is Equal
+    - Returns: Whether other is this arena; memory from one arena can only
+      be released by the same arena. */
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept {
+        return this == &other;
+    }
+
+    /* Get Used
+    - Returns: The bytes handed out since the last reset, including
+      alignment padding and overflow. */
+    size_t FrameArena::getUsed() const {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        return std::min(offset.load(std::memory_order_relaxed), capacity)
+            + overflowBytes;
+    }
+
+    /* Get Capacity
+    - Returns: The size of the block, in bytes. */
+    size_t FrameArena::getCapacity() const {
+        return capacity;
+    }
+
+    /* Get High Water Mark
+    - Returns: The most bytes used between two resets so far. */
+    size_t FrameArena::getHighWaterMark() const {
+        return highWaterMark;
+    }
+
+    /* Get Overflow Count
+    - Returns: The requests since the last reset that did not fit in the
+      block. Non-zero in steady state means the arena is still growing. */
+    size_t FrameArena::getOverflowCount() const {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        return overflows.size();
+    }
+}; // namespace omelette::utils
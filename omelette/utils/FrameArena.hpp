@@ -0,0 +1,82 @@
+#ifndef OMELETTE_UTILS_FRAMEARENA_HPP
+#define OMELETTE_UTILS_FRAMEARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace omelette::utils {
+    // Linear allocator for data that lives for one simulation step. Memory
+    // is handed out by bumping an offset into one block, lock-free so
+    // systems on several threads can share it; deallocate does nothing and
+    // reset() frees everything at once in O(1). Requests that do not fit
+    // go to the upstream resource until the next reset, which grows the
+    // block to the step's high-water mark, so after a few steps the arena
+    // stops calling malloc altogether.
+    //
+    // Use it through std::pmr containers, e.g.
+    //     std::pmr::vector<Entity> scratch(&arena);
+    // and never keep such a container past the reset.
+    class FrameArena: public std::pmr::memory_resource {
+      public:
+        // Create an arena with an initial block of the given size
+        explicit FrameArena(
+            size_t initialCapacity = 64 * 1024,
+            std::pmr::memory_resource* upstream =
+                std::pmr::new_delete_resource()
+        );
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Free every allocation. No allocation may be in use.
+        void reset();
+
+        // Bytes handed out since the last reset, including overflow
+        size_t getUsed() const;
+
+        // Size of the block served without calling upstream
+        size_t getCapacity() const;
+
+        // Most bytes used between two resets so far
+        size_t getHighWaterMark() const;
+
+        // Number of requests since the last reset that did not fit
+        size_t getOverflowCount() const;
+
+      protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment)
+            override;
+        bool do_is_equal(const std::pmr::memory_resource& other
+        ) const noexcept override;
+
+      private:
+        // Allocation made upstream because the block was full
+        struct Overflow {
+            void* pointer;
+            size_t bytes;
+            size_t alignment;
+        };
+
+        std::pmr::memory_resource* upstream;
+
+        std::byte* block = nullptr;
+        size_t capacity = 0;
+        std::atomic<size_t> offset{0}; // Next free byte in the block
+
+        std::vector<Overflow> overflows;
+        size_t overflowBytes = 0;
+        mutable std::mutex overflowMutex;
+
+        size_t highWaterMark = 0;
+
+        // Replace the block with one of the given size
+        void allocateBlock(size_t size);
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_FRAMEARENA_HPP
@@ -0,0 +1,87 @@
+#include "IndexBuffer.hpp"
+
+namespace omelette::utils {
+    /* IndexBuffer Constructor
+    - Takes over a vector of 16-bit indices.
+    - Parameters:
+        - indices: The triangle indices. */
+    IndexBuffer::IndexBuffer(std::vector<uint16_t> indices) :
+        indices(std::move(indices)) {}
+
+    /* IndexBuffer Constructor
+    - Takes over a vector of 32-bit indices. Call compact() to narrow them
+      once the vertex count is known.
+    - Parameters:
+        - indices: The triangle indices. */
+    IndexBuffer::IndexBuffer(std::vector<uint32_t> indices) :
+        indices(std::move(indices)) {}
+
+    /* Compact
+    - Converts 32-bit indices to 16-bit ones, halving the buffer, when
+      16 bits can address every vertex of the mesh. Does nothing otherwise.
+    - Parameters:
+        - vertexCount: The number of vertices the indices refer to. */
+    void IndexBuffer::compact(size_t vertexCount) {
+        const auto* wide = get<uint32_t>();
+        if (!wide || !indexFits<uint16_t>(vertexCount)) {
+            return;
+        }
+
+        std::vector<uint16_t> narrow(wide->size());
+        for (size_t i = 0; i < wide->size(); i++) {
+            narrow[i] = static_cast<uint16_t>((*wide)[i]);
+        }
+        indices = std::move(narrow);
+    }
+
+    /* Get Type
+    - Returns: The width of the stored indices. */
+    IndexType IndexBuffer::getType() const {
+        return std::holds_alternative<std::vector<uint16_t>>(indices)
+            ? IndexType::UInt16
+            : IndexType::UInt32;
+    }
+
+    /* Size
+    - Returns: The number of indices. */
+    size_t IndexBuffer::size() const {
+        return visit([](const auto& typed) { return typed.size(); });
+    }
+
+    /* Empty
+    - Returns: Whether the buffer holds no indices. */
+    bool IndexBuffer::empty() const {
+        return size() == 0;
+    }
+
+    /* Get Index Size
+    - Returns: The size of one index in bytes. */
+    size_t IndexBuffer::getIndexSize() const {
+        return getType() == IndexType::UInt16 ? sizeof(uint16_t)
+                                              : sizeof(uint32_t);
+    }
+
+    /* Get Byte Size
+    - Returns: The size of the packed indices in bytes. */
+    size_t IndexBuffer::getByteSize() const {
+        return size() * getIndexSize();
+    }
+
+    /* Data
+    - Returns: A pointer to the packed indices, getByteSize() bytes long. */
+    const void* IndexBuffer::data() const {
+        return visit([](const auto& typed) -> const void* {
+            return typed.data();
+        });
+    }
+
+    /* Index Operator
+    - Reads a single index. Loops over many indices should use visit()
+      instead, which avoids the width check per index.
+    - Parameters:
+        - i: The position of the index.
+    - Returns: The index, widened to 32 bits. */
+    uint32_t IndexBuffer::operator[](size_t i) const {
+        return visit([i](const auto& typed) -> uint32_t { return typed[i]; });
+    }
+}; // namespace omelette::utils
@@ -0,0 +1,73 @@
+#ifndef OMELETTE_UTILS_INDEXBUFFER_HPP
+#define OMELETTE_UTILS_INDEXBUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace omelette::utils {
+    // Width of the indices in an IndexBuffer
+    enum class IndexType : uint8_t { UInt16, UInt32 };
+
+    // Whether an index type can address every vertex of a mesh
+    template<typename Index>
+    constexpr bool indexFits(size_t vertexCount) {
+        return vertexCount
+            <= static_cast<size_t>(std::numeric_limits<Index>::max()) + 1;
+    }
+
+    // Triangle indices stored as 16- or 32-bit integers. The storage is
+    // tightly packed, so data() can be uploaded to the GPU as is with the
+    // matching element type.
+    class IndexBuffer {
+      private:
+        std::variant<std::vector<uint16_t>, std::vector<uint32_t>> indices;
+
+      public:
+        // Empty buffer of 16-bit indices
+        IndexBuffer() = default;
+
+        // Buffers taking over a vector of indices
+        IndexBuffer(std::vector<uint16_t> indices);
+        IndexBuffer(std::vector<uint32_t> indices);
+
+        // Convert 32-bit indices to 16-bit ones if every vertex of a mesh
+        // with vertexCount vertices can be addressed with them
+        void compact(size_t vertexCount);
+
+        // Width of the indices
+        IndexType getType() const;
+
+        // Number of indices
+        size_t size() const;
+        bool empty() const;
+
+        // Size of one index and of the whole buffer, in bytes
+        size_t getIndexSize() const;
+        size_t getByteSize() const;
+
+        // Start of the packed indices
+        const void* data() const;
+
+        // Index i, widened
+        uint32_t operator[](size_t i) const;
+
+        // The indices if they are of type Index, nullptr otherwise
+        template<typename Index>
+        const std::vector<Index>* get() const {
+            return std::get_if<std::vector<Index>>(&indices);
+        }
+
+        // Call a visitor with the typed vector of indices, so loops over
+        // them are compiled once per width instead of branching per index
+        template<typename Visitor>
+        decltype(auto) visit(Visitor&& visitor) const {
+            return std::visit(std::forward<Visitor>(visitor), indices);
+        }
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_INDEXBUFFER_HPP
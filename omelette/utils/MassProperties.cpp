@@ -0,0 +1,196 @@
+#include "MassProperties.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "AABB.hpp"
+
+namespace omelette::utils {
+    namespace {
+        // Subexpressions of the polyhedral integrals along one axis, for a
+        // triangle with coordinates w0, w1 and w2 on that axis
+        struct AxisTerms {
+            double f1, f2, f3, g0, g1, g2;
+        };
+
+        AxisTerms axisTerms(double w0, double w1, double w2) {
+            const double sum = w0 + w1;
+            const double square = w0 * w0;
+            const double partial = square + w1 * sum;
+
+            AxisTerms terms;
+            terms.f1 = sum + w2;
+            terms.f2 = partial + w2 * terms.f1;
+            terms.f3 = w0 * square + w1 * partial + w2 * terms.f2;
+            terms.g0 = terms.f2 + w0 * (terms.f1 + w0);
+            terms.g1 = terms.f2 + w1 * (terms.f1 + w1);
+            terms.g2 = terms.f2 + w2 * (terms.f1 + w2);
+            return terms;
+        }
+    } // namespace
+
+    /* MassProperties Default Constructor
+    - Creates a point mass at the origin with no volume. */
+    MassProperties::MassProperties() :
+        volume(0.0f),
+        centroid(),
+        inertia(),
+        products() {}
+
+    /* Box
+    - Parameters:
+        - halfExtents: Half the size of the box along each axis.
+    - Returns: The properties of a solid box. A zero extent gives the
+      limit of a thin plate, which has no volume but a finite inertia. */
+    MassProperties MassProperties::box(const Vec3& halfExtents) {
+        const float x2 = halfExtents.x * halfExtents.x;
+        const float y2 = halfExtents.y * halfExtents.y;
+        const float z2 = halfExtents.z * halfExtents.z;
+
+        MassProperties properties;
+        properties.volume =
+            8.0f * halfExtents.x * halfExtents.y * halfExtents.z;
+        properties.inertia =
+            Vec3((y2 + z2) / 3.0f, (x2 + z2) / 3.0f, (x2 + y2) / 3.0f);
+        return properties;
+    }
+
+    /* Sphere
+    - Parameters:
+        - radius: The radius of the sphere.
+    - Returns: The properties of a solid sphere. */
+    MassProperties MassProperties::sphere(float radius) {
+        const float r2 = radius * radius;
+        const float moment = 0.4f * r2;
+
+        MassProperties properties;
+        properties.volume = 4.0f / 3.0f * float(M_PI) * r2 * radius;
+        properties.inertia = Vec3(moment, moment, moment);
+        return properties;
+    }
+
+    /* Cylinder
+    - Parameters:
+        - radius: The radius of the cylinder.
+        - height: The height of the cylinder, along the y axis.
+    - Returns: The properties of a solid cylinder. */
+    MassProperties MassProperties::cylinder(float radius, float height) {
+        const float r2 = radius * radius;
+        const float side = (3.0f * r2 + height * height) / 12.0f;
+
+        MassProperties properties;
+        properties.volume = float(M_PI) * r2 * height;
+        properties.inertia = Vec3(side, 0.5f * r2, side);
+        return properties;
+    }
+
+    /* From Mesh
+    - Integrates volume, first and second moments over the solid bounded
+      by a triangle mesh, turning each volume integral into a sum over the
+      faces with the divergence theorem (Eberly, "Polyhedral Mass
+      Properties"). One pass over the triangles, accumulated in double.
+      Meshes wound inside out give the same result. Open or flat meshes
+      enclose no volume; they get the center of their bounds and no
+      inertia.
+    - Parameters:
+        - vertices: The mesh vertices.
+        - indices: Triangle list over the vertices.
+    - Returns: The properties of the enclosed solid. */
+    MassProperties MassProperties::fromMesh(
+        const std::vector<Vec3>& vertices,
+        const IndexBuffer& indices
+    ) {
+        // Integrals of 1, x, y, z, x^2, y^2, z^2, xy, yz and zx
+        double integrals[10] = {};
+
+        indices.visit([&](const auto& typed) {
+            for (size_t i = 0; i + 2 < typed.size(); i += 3) {
+                const Vec3& p0 = vertices[typed[i]];
+                const Vec3& p1 = vertices[typed[i + 1]];
+                const Vec3& p2 = vertices[typed[i + 2]];
+
+                // Unnormalized face normal
+                const double e1[3] = {
+                    double(p1.x) - p0.x,
+                    double(p1.y) - p0.y,
+                    double(p1.z) - p0.z
+                };
+                const double e2[3] = {
+                    double(p2.x) - p0.x,
+                    double(p2.y) - p0.y,
+                    double(p2.z) - p0.z
+                };
+                const double nx = e1[1] * e2[2] - e1[2] * e2[1];
+                const double ny = e1[2] * e2[0] - e1[0] * e2[2];
+                const double nz = e1[0] * e2[1] - e1[1] * e2[0];
+
+                const AxisTerms x = axisTerms(p0.x, p1.x, p2.x);
+                const AxisTerms y = axisTerms(p0.y, p1.y, p2.y);
+                const AxisTerms z = axisTerms(p0.z, p1.z, p2.z);
+
+                integrals[0] += nx * x.f1;
+                integrals[1] += nx * x.f2;
+                integrals[2] += ny * y.f2;
+                integrals[3] += nz * z.f2;
+                integrals[4] += nx * x.f3;
+                integrals[5] += ny * y.f3;
+                integrals[6] += nz * z.f3;
+                integrals[7] += nx * (p0.y * x.g0 + p1.y * x.g1 + p2.y * x.g2);
+                integrals[8] += ny * (p0.z * y.g0 + p1.z * y.g1 + p2.z * y.g2);
+                integrals[9] += nz * (p0.x * z.g0 + p1.x * z.g1 + p2.x * z.g2);
+            }
+        });
+
+        const double scales[10] = {
+            1.0 / 6.0,
+            1.0 / 24.0,
+            1.0 / 24.0,
+            1.0 / 24.0,
+            1.0 / 60.0,
+            1.0 / 60.0,
+            1.0 / 60.0,
+            1.0 / 120.0,
+            1.0 / 120.0,
+            1.0 / 120.0
+        };
+        for (int i = 0; i < 10; i++) {
+            integrals[i] *= scales[i];
+        }
+
+        // Every integral flips sign with the winding
+        if (integrals[0] < 0.0) {
+            for (double& integral : integrals) {
+                integral = -integral;
+            }
+        }
+
+        MassProperties properties;
+        const AABB bounds = AABB::fromPoints(vertices);
+        const Vec3 size = bounds.max - bounds.min;
+        const double boundsVolume = double(size.x) * size.y * size.z;
+        const double volume = integrals[0];
+        if (volume <= boundsVolume * std::numeric_limits<float>::epsilon()) {
+            properties.centroid = bounds.center();
+            return properties;
+        }
+
+        const double cx = integrals[1] / volume;
+        const double cy = integrals[2] / volume;
+        const double cz = integrals[3] / volume;
+
+        // Second moments per unit mass, shifted to the centroid
+        const double xx = integrals[4] / volume - cx * cx;
+        const double yy = integrals[5] / volume - cy * cy;
+        const double zz = integrals[6] / volume - cz * cz;
+        const double xy = integrals[7] / volume - cx * cy;
+        const double yz = integrals[8] / volume - cy * cz;
+        const double zx = integrals[9] / volume - cz * cx;
+
+        properties.volume = float(volume);
+        properties.centroid = Vec3(float(cx), float(cy), float(cz));
+        properties.inertia =
+            Vec3(float(yy + zz), float(xx + zz), float(xx + yy));
+        properties.products = Vec3(float(-xy), float(-yz), float(-zx));
+        return properties;
+    }
+}; // namespace omelette::utils
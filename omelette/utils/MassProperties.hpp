@@ -0,0 +1,36 @@
+#ifndef OMELETTE_UTILS_MASSPROPERTIES_HPP
+#define OMELETTE_UTILS_MASSPROPERTIES_HPP
+
+#include <vector>
+
+#include "IndexBuffer.hpp"
+#include "Vec3.hpp"
+
+namespace omelette::utils {
+    // Mass distribution of a solid of uniform density. The inertia tensor
+    // is about the centroid and per unit mass: multiply it by a body's mass
+    // to get the body's tensor.
+    class MassProperties {
+      public:
+        float volume; // Enclosed volume, the mass at unit density
+        Vec3 centroid; // Center of mass
+        Vec3 inertia; // Diagonal of the inertia tensor (Ixx, Iyy, Izz)
+        Vec3 products; // Off-diagonal entries (Ixy, Iyz, Izx)
+
+        // Default constructor (point mass at the origin)
+        MassProperties();
+
+        // Closed forms for solids centered on the origin
+        static MassProperties box(const Vec3& halfExtents);
+        static MassProperties sphere(float radius);
+        static MassProperties cylinder(float radius, float height);
+
+        // Integral over a closed, consistently wound triangle mesh
+        static MassProperties fromMesh(
+            const std::vector<Vec3>& vertices,
+            const IndexBuffer& indices
+        );
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_MASSPROPERTIES_HPP
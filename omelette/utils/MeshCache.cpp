@@ -0,0 +1,274 @@
+#include "MeshCache.hpp"
+
+#include <tuple>
+#include <utility>
+
+#include "Shapes.hpp"
+
+namespace omelette::utils {
+    namespace {
+        // Wrap the output of a Shapes generator in a handle
+        template<typename Index>
+        MeshHandle fromShape(
+            std::tuple<std::vector<Vec3>, std::vector<Index>>&& shape,
+            const MassProperties& massProperties
+        ) {
+            return makeMesh(
+                std::move(std::get<0>(shape)),
+                std::move(std::get<1>(shape)),
+                massProperties
+            );
+        }
+
+        // Run a Shapes generator with the narrowest index type that
+        // addresses vertexCount vertices. generate is called with a value
+        // of the chosen type, which only carries the type.
+        template<typename Generate>
+        MeshHandle generateCompact(
+            size_t vertexCount,
+            const MassProperties& massProperties,
+            Generate&& generate
+        ) {
+            if (indexFits<uint16_t>(vertexCount)) {
+                return fromShape(generate(uint16_t()), massProperties);
+            }
+            return fromShape(generate(uint32_t()), massProperties);
+        }
+    } // namespace
+
+    /* Make Mesh
+    - Wraps geometry in an immutable, reference-counted mesh and integrates
+      its mass properties over the triangles.
+    - Parameters:
+        - vertices: The rest-pose vertices.
+        - indices: The triangle indices.
+    - Returns: A handle to the new mesh. */
+    MeshHandle makeMesh(std::vector<Vec3> vertices, IndexBuffer indices) {
+        const MassProperties massProperties =
+            MassProperties::fromMesh(vertices, indices);
+        return makeMesh(
+            std::move(vertices),
+            std::move(indices),
+            massProperties
+        );
+    }
+
+    /* Make Mesh
+    - Wraps geometry in an immutable, reference-counted mesh and computes
+      its bounding volumes once. 32-bit indices are narrowed to 16 bits
+      when the vertex count allows it.
+    - Parameters:
+        - vertices: The rest-pose vertices.
+        - indices: The triangle indices.
+        - massProperties: The mass properties to store with the mesh.
+    - Returns: A handle to the new mesh. */
+    MeshHandle makeMesh(
+        std::vector<Vec3> vertices,
+        IndexBuffer indices,
+        const MassProperties& massProperties
+    ) {
+        auto mesh = std::make_shared<MeshData>();
+        mesh->bounds = AABB::fromPoints(vertices);
+        mesh->boundingSphere = BoundingSphere::fromPoints(vertices);
+        mesh->massProperties = massProperties;
+        indices.compact(vertices.size());
+        mesh->vertices = std::move(vertices);
+        mesh->indices = std::move(indices);
+        return mesh;
+    }
+
+    /* Key Equality
+    - Keys are equal when generator and every parameter match exactly. */
+    bool MeshCache::Key::operator==(const Key& other) const {
+        return generator == other.generator && sizes[0] == other.sizes[0]
+            && sizes[1] == other.sizes[1] && sizes[2] == other.sizes[2]
+            && counts[0] == other.counts[0] && counts[1] == other.counts[1];
+    }
+
+    /* Key Hash
+    - Combines the generator and the bits of every parameter. */
+    size_t MeshCache::KeyHash::operator()(const Key& key) const {
+        size_t hash = static_cast<size_t>(key.generator);
+        auto combine = [&hash](size_t value) {
+            hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+        };
+        for (float size : key.sizes) {
+            combine(std::hash<float>()(size));
+        }
+        for (unsigned int count : key.counts) {
+            combine(count);
+        }
+        return hash;
+    }
+
+    /* Get Or Create
+    - Returns the cached mesh for a key if it is still alive. Otherwise the
+      mesh is generated, outside the lock so other lookups are not held up,
+      and registered; if another thread registered the same key meanwhile,
+      its mesh wins so both callers share it.
+    - Parameters:
+        - key: The generator and parameters.
+        - generate: Builds the mesh on a miss.
+    - Returns: A handle to the shared mesh. */
+    MeshHandle MeshCache::getOrCreate(
+        const Key& key,
+        const std::function<MeshHandle()>& generate
+    ) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = entries.find(key);
+            if (found != entries.end()) {
+                if (MeshHandle mesh = found->second.lock()) {
+                    return mesh;
+                }
+            }
+        }
+
+        MeshHandle mesh = generate();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = entries[key];
+        if (MeshHandle existing = entry.lock()) {
+            return existing;
+        }
+        entry = mesh;
+        return mesh;
+    }
+
+    /* Cube
+    - Returns: The shared mesh of Shapes::createCube with these
+      parameters. */
+    MeshHandle MeshCache::cube(float width, float height, float depth) {
+        return getOrCreate(
+            {Generator::Cube, {width, height, depth}, {0, 0}},
+            [&] {
+                const MassProperties massProperties = MassProperties::box(
+                    Vec3(width * 0.5f, height * 0.5f, depth * 0.5f)
+                );
+                return generateCompact(8, massProperties, [&](auto index) {
+                    return Shapes::createCube<decltype(index)>(
+                        width,
+                        height,
+                        depth
+                    );
+                });
+            }
+        );
+    }
+
+    /* Plane
+    - Returns: The shared mesh of Shapes::createPlane with these
+      parameters. */
+    MeshHandle MeshCache::plane(float width, float depth) {
+        return getOrCreate(
+            {Generator::Plane, {width, depth, 0.0f}, {0, 0}},
+            [&] {
+                const MassProperties massProperties = MassProperties::box(
+                    Vec3(width * 0.5f, 0.0f, depth * 0.5f)
+                );
+                return generateCompact(4, massProperties, [&](auto index) {
+                    return Shapes::createPlane<decltype(index)>(width, depth);
+                });
+            }
+        );
+    }
+
+    /* UV Sphere
+    - Returns: The shared mesh of Shapes::createUVSphere with these
+      parameters. */
+    MeshHandle MeshCache::uvSphere(
+        float radius,
+        unsigned int segments,
+        unsigned int rings
+    ) {
+        return getOrCreate(
+            {Generator::UVSphere, {radius, 0.0f, 0.0f}, {segments, rings}},
+            [&] {
+                return generateCompact(
+                    Shapes::uvSphereVertexCount(segments, rings),
+                    MassProperties::sphere(radius),
+                    [&](auto index) {
+                        return Shapes::createUVSphere<decltype(index)>(
+                            radius,
+                            segments,
+                            rings
+                        );
+                    }
+                );
+            }
+        );
+    }
+
+    /* Icosphere
+    - Returns: The shared mesh of Shapes::createIcosphere with these
+      parameters. */
+    MeshHandle MeshCache::icosphere(float radius, unsigned int subdivisions) {
+        return getOrCreate(
+            {Generator::Icosphere, {radius, 0.0f, 0.0f}, {subdivisions, 0}},
+            [&] {
+                return generateCompact(
+                    Shapes::icosphereVertexCount(subdivisions),
+                    MassProperties::sphere(radius),
+                    [&](auto index) {
+                        return Shapes::createIcosphere<decltype(index)>(
+                            radius,
+                            subdivisions
+                        );
+                    }
+                );
+            }
+        );
+    }
+
+    /* Cylinder
+    - Returns: The shared mesh of Shapes::createCylinder with these
+      parameters. */
+    MeshHandle MeshCache::cylinder(
+        float radius,
+        float height,
+        unsigned int segments
+    ) {
+        return getOrCreate(
+            {Generator::Cylinder, {radius, height, 0.0f}, {segments, 0}},
+            [&] {
+                return generateCompact(
+                    Shapes::cylinderVertexCount(segments),
+                    MassProperties::cylinder(radius, height),
+                    [&](auto index) {
+                        return Shapes::createCylinder<decltype(index)>(
+                            radius,
+                            height,
+                            segments
+                        );
+                    }
+                );
+            }
+        );
+    }
+
+    /* Purge
+    - Removes the entries of meshes that no handle refers to any more. */
+    void MeshCache::purge() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->second.expired()) {
+                it = entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /* Size
+    - Returns: The number of cached meshes that are still alive. */
+    size_t MeshCache::size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = 0;
+        for (const auto& entry : entries) {
+            if (!entry.second.expired()) {
+                count++;
+            }
+        }
+        return count;
+    }
+}; // namespace omelette::utils
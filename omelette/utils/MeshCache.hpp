@@ -0,0 +1,108 @@
+#ifndef OMELETTE_UTILS_MESHCACHE_HPP
+#define OMELETTE_UTILS_MESHCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "AABB.hpp"
+#include "BoundingSphere.hpp"
+#include "IndexBuffer.hpp"
+#include "MassProperties.hpp"
+#include "Vec3.hpp"
+
+namespace omelette::utils {
+    // Immutable geometry shared by every mesh instance made from it, with
+    // the bounding volumes and mass properties derived from it once
+    struct MeshData {
+        std::vector<Vec3> vertices; // Rest-pose vertices
+        IndexBuffer indices; // Triangle indices, as narrow as possible
+        AABB bounds; // Bounds of the vertices
+        BoundingSphere boundingSphere; // Sphere around the vertices
+        MassProperties massProperties; // Of the solid at uniform density
+    };
+
+    // Shared, reference-counted handle to mesh geometry
+    using MeshHandle = std::shared_ptr<const MeshData>;
+
+    // Wrap geometry in a handle of its own, without deduplication. The
+    // indices are narrowed to 16 bits if the vertex count allows it. Mass
+    // properties are integrated over the mesh unless they are given.
+    MeshHandle makeMesh(std::vector<Vec3> vertices, IndexBuffer indices);
+    MeshHandle makeMesh(
+        std::vector<Vec3> vertices,
+        IndexBuffer indices,
+        const MassProperties& massProperties
+    );
+
+    // Registry of generated meshes, deduplicated by generator and
+    // parameters: asking twice for the same icosphere returns the same
+    // geometry. Meshes are generated straight into the narrowest index
+    // type their vertex count allows, with the closed-form mass properties
+    // of the solid they approximate. Entries hold weak references, so an
+    // asset is freed when its last handle is dropped and regenerated if
+    // asked for again. Safe to use from several threads.
+    class MeshCache {
+      private:
+        // Generator of a cached mesh
+        enum class Generator { Cube, Plane, UVSphere, Icosphere, Cylinder };
+
+        // Generator and its parameters; unused parameters are zero
+        struct Key {
+            Generator generator;
+            float sizes[3];
+            unsigned int counts[2];
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHash {
+            size_t operator()(const Key& key) const;
+        };
+
+        std::unordered_map<Key, std::weak_ptr<const MeshData>, KeyHash>
+            entries;
+        mutable std::mutex mutex;
+
+        // Return the live mesh for a key, or generate and register it
+        MeshHandle getOrCreate(
+            const Key& key,
+            const std::function<MeshHandle()>& generate
+        );
+
+      public:
+        // Shared versions of the utils::Shapes generators
+        MeshHandle cube(
+            float width = 1.0f,
+            float height = 1.0f,
+            float depth = 1.0f
+        );
+        MeshHandle plane(float width = 1.0f, float depth = 1.0f);
+        MeshHandle uvSphere(
+            float radius = 1.0f,
+            unsigned int segments = 16,
+            unsigned int rings = 16
+        );
+        MeshHandle icosphere(
+            float radius = 1.0f,
+            unsigned int subdivisions = 1
+        );
+        MeshHandle cylinder(
+            float radius = 1.0f,
+            float height = 1.0f,
+            unsigned int segments = 16
+        );
+
+        // Forget entries whose meshes have been freed
+        void purge();
+
+        // Number of entries whose meshes are still alive
+        size_t size() const;
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_MESHCACHE_HPP
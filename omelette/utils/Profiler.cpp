@@ -0,0 +1,334 @@
+#include "Profiler.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace omelette::utils {
+    namespace {
+        // Buffer of the current thread, once it has recorded something
+        thread_local ProfileBuffer* currentBuffer = nullptr;
+
+        // Write a name as a JSON string
+        void writeString(std::ostream& output, const char* text) {
+            output << '"';
+            for (; *text; text++) {
+                if (*text == '"' || *text == '\\') {
+                    output << '\\';
+                }
+                output << *text;
+            }
+            output << '"';
+        }
+
+        // Write nanoseconds as the microseconds Chrome traces use
+        void writeMicroseconds(std::ostream& output, uint64_t nanoseconds) {
+            output << nanoseconds / 1000 << '.';
+            const uint64_t fraction = nanoseconds % 1000;
+            output << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+        }
+    } // namespace
+
+    /* ProfileBuffer Constructor
+    - Parameters:
+        - threadId: The thread's id in the trace. */
+    ProfileBuffer::ProfileBuffer(uint32_t threadId) :
+        events(new ProfileEvent[CAPACITY]),
+        threadId(threadId) {}
+
+    /* Push
+    - Appends a zone to the ring. Called by the owning thread only.
+    - Parameters:
+        - event: The finished zone.
+    - Returns: False if the ring was full and the zone was dropped. */
+    bool ProfileBuffer::push(const ProfileEvent& event) {
+        const uint64_t write = head.load(std::memory_order_relaxed);
+        if (write - tail.load(std::memory_order_acquire) == CAPACITY) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        events[write & (CAPACITY - 1)] = event;
+        head.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /* Add Counter
+    - Adds to the thread's counter of the given name, registering it on
+      first use. Names are matched by pointer first, then by contents, so
+      the same literal in several translation units is one counter. Once
+      MAX_COUNTERS names are in use, new names are ignored.
+    - Parameters:
+        - name: The counter's name.
+        - amount: The amount to add. */
+    void ProfileBuffer::addCounter(const char* name, uint64_t amount) {
+        const size_t count = counterCount.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; i++) {
+            if (counters[i].name == name
+                || std::strcmp(counters[i].name, name) == 0) {
+                counters[i].value.fetch_add(amount, std::memory_order_relaxed);
+                return;
+            }
+        }
+        if (count == MAX_COUNTERS) {
+            return;
+        }
+
+        counters[count].name = name;
+        counters[count].value.store(amount, std::memory_order_relaxed);
+        counterCount.store(count + 1, std::memory_order_release);
+    }
+
+    /* Get Thread Id
+    - Returns: The thread's id in the trace. */
+    uint32_t ProfileBuffer::getThreadId() const {
+        return threadId;
+    }
+
+    /* Get Dropped Count
+    - Returns: The number of zones dropped because the ring was full. */
+    uint64_t ProfileBuffer::getDroppedCount() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    /* Profiler Constructor
+    - Starts the clock all timestamps are measured from. */
+    Profiler::Profiler() : epoch(std::chrono::steady_clock::now()) {}
+
+    /* Get
+    - Returns: The process-wide profiler, created on first use. */
+    Profiler& Profiler::get() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    /* Now
+    - Returns: Nanoseconds since the profiler was created. */
+    uint64_t Profiler::now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - epoch
+        )
+            .count();
+    }
+
+    /* Thread Buffer
+    - Returns the calling thread's buffer, registering a new one the first
+      time a thread records something. Buffers live as long as the
+      profiler, so zones of threads that have exited are still collected.
+    - Returns: The calling thread's buffer. */
+    ProfileBuffer& Profiler::threadBuffer() {
+        if (!currentBuffer) {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            const auto threadId = static_cast<uint32_t>(buffers.size());
+            buffers.push_back(std::make_unique<ProfileBuffer>(threadId));
+            currentBuffer = buffers.back().get();
+        }
+        return *currentBuffer;
+    }
+
+    /* Record Zone
+    - Queues a finished zone on the calling thread's buffer.
+    - Parameters:
+        - name: The zone's name, which must outlive the profiler.
+        - start: When the zone started, from now().
+        - end: When the zone ended, from now(). */
+    void Profiler::recordZone(const char* name, uint64_t start, uint64_t end) {
+        threadBuffer().push({name, start, end});
+    }
+
+    /* Add Counter
+    - Adds to a counter of the current frame, e.g. bodies integrated.
+    - Parameters:
+        - name: The counter's name, which must outlive the profiler.
+        - amount: The amount to add. */
+    void Profiler::addCounter(const char* name, uint64_t amount) {
+        threadBuffer().addCounter(name, amount);
+    }
+
+    /* End Frame
+    - Drains every thread's zones and totals the counters added since the
+      last call, which become getFrameCounters(). Counters seen in earlier
+      frames are kept with a total of zero, so the list is stable. While
+      capturing, the zones and totals are kept for the trace.
+      Call once per frame from one thread. */
+    void Profiler::endFrame() {
+        std::lock_guard<std::mutex> frameLock(frameMutex);
+        const bool capture = capturing.load(std::memory_order_relaxed);
+
+        for (auto& counter : frameCounters) {
+            counter.second = 0;
+        }
+        auto addTotal = [this](const char* name, uint64_t value) {
+            for (auto& counter : frameCounters) {
+                if (std::strcmp(counter.first, name) == 0) {
+                    counter.second += value;
+                    return;
+                }
+            }
+            frameCounters.emplace_back(name, value);
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            for (auto& buffer : buffers) {
+                const uint32_t threadId = buffer->getThreadId();
+                buffer->drain([&](const ProfileEvent& event) {
+                    if (capture) {
+                        capturedZones.push_back({threadId, event});
+                    }
+                });
+                buffer->takeCounters(addTotal);
+            }
+        }
+
+        if (allocationCounter) {
+            const uint64_t allocations = allocationCounter();
+            addTotal("allocations", allocations - lastAllocationCount);
+            lastAllocationCount = allocations;
+        }
+
+        const uint64_t frameEnd = now();
+        if (capture) {
+            capturedFrames.push_back({frameStart, frameEnd, frameCounters});
+        }
+        frameStart = frameEnd;
+        frameCount++;
+    }
+
+    /* Start Capture
+    - Starts keeping zones and counter totals at the end of each frame.
+      Memory grows with the capture, so keep captures short. */
+    void Profiler::startCapture() {
+        capturing.store(true, std::memory_order_relaxed);
+    }
+
+    /* Stop Capture
+    - Stops keeping frames; what was captured is kept. */
+    void Profiler::stopCapture() {
+        capturing.store(false, std::memory_order_relaxed);
+    }
+
+    /* Clear Capture
+    - Frees every captured zone and frame. */
+    void Profiler::clearCapture() {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        capturedZones.clear();
+        capturedFrames.clear();
+    }
+
+    /* Write Chrome Trace
+    - Writes the capture as a Chrome trace, which chrome://tracing and
+      ui.perfetto.dev open: a complete event per zone, on its thread, a
+      counter track per counter and a "Frame" zone per frame.
+    - Parameters:
+        - output: The stream to write the JSON to. */
+    void Profiler::writeChromeTrace(std::ostream& output) const {
+        std::lock_guard<std::mutex> frameLock(frameMutex);
+
+        output << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+        bool first = true;
+        auto beginEvent = [&]() {
+            output << (first ? "  {" : ",\n  {");
+            first = false;
+        };
+
+        // Name the threads; frames get a track of their own
+        size_t threadCount;
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            threadCount = buffers.size();
+        }
+        for (size_t thread = 0; thread <= threadCount; thread++) {
+            beginEvent();
+            output << "\"name\": \"thread_name\", \"ph\": \"M\", "
+                   << "\"pid\": 1, \"tid\": " << thread
+                   << ", \"args\": {\"name\": ";
+            if (thread == threadCount) {
+                output << "\"Frames\"}}";
+            } else {
+                output << "\"Thread " << thread << "\"}}";
+            }
+        }
+
+        for (const auto& zone : capturedZones) {
+            beginEvent();
+            output << "\"name\": ";
+            writeString(output, zone.event.name);
+            output << ", \"cat\": \"omelette\", \"ph\": \"X\", \"ts\": ";
+            writeMicroseconds(output, zone.event.start);
+            output << ", \"dur\": ";
+            writeMicroseconds(output, zone.event.end - zone.event.start);
+            output << ", \"pid\": 1, \"tid\": " << zone.threadId << "}";
+        }
+
+        for (const auto& frame : capturedFrames) {
+            beginEvent();
+            output << "\"name\": \"Frame\", \"cat\": \"omelette\", "
+                   << "\"ph\": \"X\", \"ts\": ";
+            writeMicroseconds(output, frame.start);
+            output << ", \"dur\": ";
+            writeMicroseconds(output, frame.end - frame.start);
+            output << ", \"pid\": 1, \"tid\": " << threadCount << "}";
+
+            for (const auto& [name, value] : frame.counters) {
+                beginEvent();
+                output << "\"name\": ";
+                writeString(output, name);
+                output << ", \"ph\": \"C\", \"ts\": ";
+                writeMicroseconds(output, frame.end);
+                output << ", \"pid\": 1, \"args\": {\"value\": " << value
+                       << "}}";
+            }
+        }
+
+        output << "\n]}\n";
+    }
+
+    /* Save Chrome Trace
+    - Writes the capture to a file; see writeChromeTrace.
+    - Parameters:
+        - path: The file to write.
+    - Returns: Whether the file was written. */
+    bool Profiler::saveChromeTrace(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+        writeChromeTrace(file);
+        return static_cast<bool>(file);
+    }
+
+    /* Set Allocation Counter
+    - Parameters:
+        - counter: Returns a running count of allocations, or nullptr to
+          stop reporting them. */
+    void Profiler::setAllocationCounter(uint64_t (*counter)()) {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        allocationCounter = counter;
+        lastAllocationCount = counter ? counter() : 0;
+    }
+
+    /* Get Frame Counters
+    - Returns: Each counter's total over the last frame. Read it from the
+      thread calling endFrame(). */
+    const Profiler::CounterTotals& Profiler::getFrameCounters() const {
+        return frameCounters;
+    }
+
+    /* Get Frame Count
+    - Returns: The number of frames ended so far. */
+    uint64_t Profiler::getFrameCount() const {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        return frameCount;
+    }
+
+    /* Get Dropped Count
+    - Returns: The number of zones dropped across all threads because a
+      ring was full; raise CAPACITY or end frames more often if non-zero. */
+    uint64_t Profiler::getDroppedCount() const {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        uint64_t dropped = 0;
+        for (const auto& buffer : buffers) {
+            dropped += buffer->getDroppedCount();
+        }
+        return dropped;
+    }
+}; // namespace omelette::utils
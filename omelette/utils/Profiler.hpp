@@ -0,0 +1,230 @@
+#ifndef OMELETTE_UTILS_PROFILER_HPP
+#define OMELETTE_UTILS_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace omelette::utils {
+    // Timed section of code on one thread. Names must be string literals or
+    // otherwise outlive the profiler.
+    struct ProfileEvent {
+        const char* name;
+        uint64_t start; // Nanoseconds since the profiler started
+        uint64_t end;
+    };
+
+    // Events and counters of one thread. Only the owning thread writes and
+    // only the profiler reads, so the ring buffer and the counters are
+    // lock-free: the writer never waits, and drops zones when the ring is
+    // full instead.
+    class ProfileBuffer {
+      public:
+        static constexpr size_t CAPACITY = 1 << 16; // Events, a power of 2
+        static constexpr size_t MAX_COUNTERS = 32; // Distinct counter names
+
+        explicit ProfileBuffer(uint32_t threadId);
+
+        // Append a zone; returns false if the ring is full. Owner only.
+        bool push(const ProfileEvent& event);
+
+        // Add to a named counter. Owner only.
+        void addCounter(const char* name, uint64_t amount);
+
+        // Remove every queued zone, oldest first. One reader at a time.
+        template<typename Function>
+        void drain(Function&& consume);
+
+        // Read every counter and reset it to zero. One reader at a time.
+        template<typename Function>
+        void takeCounters(Function&& consume);
+
+        // Getters
+        uint32_t getThreadId() const;
+        uint64_t getDroppedCount() const;
+
+      private:
+        struct Counter {
+            const char* name = nullptr;
+            std::atomic<uint64_t> value{0};
+        };
+
+        std::unique_ptr<ProfileEvent[]> events;
+        alignas(64) std::atomic<uint64_t> head{0}; // Next slot to write
+        alignas(64) std::atomic<uint64_t> tail{0}; // Next slot to read
+        std::atomic<uint64_t> dropped{0};
+
+        std::array<Counter, MAX_COUNTERS> counters;
+        std::atomic<size_t> counterCount{0};
+
+        uint32_t threadId;
+    };
+
+    // Collects zones and counters from every thread. Zones go to per-thread
+    // ring buffers; endFrame() drains them, totals the counters of the
+    // frame and, while capturing, keeps both for a Chrome trace. Use the
+    // OMELETTE_PROFILE_* macros below rather than calling it directly, so
+    // builds without OMELETTE_PROFILE pay nothing.
+    class Profiler {
+      public:
+        // Counter totals of a frame, in first-seen order
+        using CounterTotals = std::vector<std::pair<const char*, uint64_t>>;
+
+        // Process-wide profiler
+        static Profiler& get();
+
+        // Nanoseconds since the profiler started
+        uint64_t now() const;
+
+        // Record a finished zone on the calling thread
+        void recordZone(const char* name, uint64_t start, uint64_t end);
+
+        // Add to a counter of the current frame on the calling thread
+        void addCounter(const char* name, uint64_t amount);
+
+        // Close the current frame: drain every thread and total counters
+        void endFrame();
+
+        // Keep zones and counter totals for writeChromeTrace
+        void startCapture();
+        void stopCapture();
+        void clearCapture();
+
+        // Write the capture in Chrome trace / Perfetto JSON format
+        void writeChromeTrace(std::ostream& output) const;
+        bool saveChromeTrace(const std::string& path) const;
+
+        // Report the difference of this function's results between frames
+        // as the "allocations" counter, e.g. from a counting operator new
+        void setAllocationCounter(uint64_t (*counter)());
+
+        // Getters
+        const CounterTotals& getFrameCounters() const;
+        uint64_t getFrameCount() const;
+        uint64_t getDroppedCount() const;
+
+      private:
+        // A captured zone and the thread it ran on
+        struct CapturedZone {
+            uint32_t threadId;
+            ProfileEvent event;
+        };
+
+        // Counter totals at the end of a captured frame
+        struct CapturedFrame {
+            uint64_t start;
+            uint64_t end;
+            CounterTotals counters;
+        };
+
+        std::chrono::steady_clock::time_point epoch;
+
+        // Buffer of every thread that has recorded something
+        std::vector<std::unique_ptr<ProfileBuffer>> buffers;
+        mutable std::mutex buffersMutex;
+
+        // State of endFrame() and the capture, guarded by frameMutex
+        mutable std::mutex frameMutex;
+        CounterTotals frameCounters;
+        uint64_t frameCount = 0;
+        uint64_t frameStart = 0;
+        std::atomic<bool> capturing{false};
+        std::vector<CapturedZone> capturedZones;
+        std::vector<CapturedFrame> capturedFrames;
+
+        uint64_t (*allocationCounter)() = nullptr;
+        uint64_t lastAllocationCount = 0;
+
+        Profiler();
+
+        // Buffer of the calling thread, created on first use
+        ProfileBuffer& threadBuffer();
+    };
+
+    // Records the time from its construction to its destruction as a zone
+    class ProfileZone {
+      public:
+        explicit ProfileZone(const char* name) :
+            name(name),
+            start(Profiler::get().now()) {}
+
+        ~ProfileZone() {
+            Profiler& profiler = Profiler::get();
+            profiler.recordZone(name, start, profiler.now());
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+      private:
+        const char* name;
+        uint64_t start;
+    };
+
+    /* Drain
+    - Hands every queued zone to a function, oldest first, and frees their
+      slots for the writer.
+    - Parameters:
+        - consume: Called as consume(const ProfileEvent&). */
+    template<typename Function>
+    void ProfileBuffer::drain(Function&& consume) {
+        uint64_t read = tail.load(std::memory_order_relaxed);
+        const uint64_t written = head.load(std::memory_order_acquire);
+        for (; read != written; read++) {
+            consume(events[read & (CAPACITY - 1)]);
+        }
+        tail.store(read, std::memory_order_release);
+    }
+
+    /* Take Counters
+    - Hands each counter's value since the last call to a function.
+    - Parameters:
+        - consume: Called as consume(const char* name, uint64_t value). */
+    template<typename Function>
+    void ProfileBuffer::takeCounters(Function&& consume) {
+        const size_t count = counterCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; i++) {
+            const uint64_t value =
+                counters[i].value.exchange(0, std::memory_order_relaxed);
+            if (value != 0) {
+                consume(counters[i].name, value);
+            }
+        }
+    }
+}; // namespace omelette::utils
+
+// Profiling macros. Define OMELETTE_PROFILE (meson -Dprofiling=true) to
+// enable them; otherwise they compile to nothing.
+#ifdef OMELETTE_PROFILE
+    #define OMELETTE_PROFILE_CONCAT_INNER(a, b) a##b
+    #define OMELETTE_PROFILE_CONCAT(a, b) OMELETTE_PROFILE_CONCAT_INNER(a, b)
+
+    // Time the rest of the enclosing scope
+    #define OMELETTE_PROFILE_ZONE(name) \
+        ::omelette::utils::ProfileZone OMELETTE_PROFILE_CONCAT( \
+            omeletteProfileZone, \
+            __LINE__ \
+        )(name)
+
+    // Add to a per-frame counter
+    #define OMELETTE_PROFILE_COUNTER(name, amount) \
+        ::omelette::utils::Profiler::get().addCounter(name, amount)
+
+    // Close the current frame
+    #define OMELETTE_PROFILE_FRAME() \
+        ::omelette::utils::Profiler::get().endFrame()
+#else
+    #define OMELETTE_PROFILE_ZONE(name) ((void)0)
+    #define OMELETTE_PROFILE_COUNTER(name, amount) ((void)0)
+    #define OMELETTE_PROFILE_FRAME() ((void)0)
+#endif
+
+#endif // OMELETTE_UTILS_PROFILER_HPP
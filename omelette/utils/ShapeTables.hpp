@@ -0,0 +1,183 @@
+#ifndef OMELETTE_UTILS_SHAPETABLES_HPP
+#define OMELETTE_UTILS_SHAPETABLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Vec3.hpp"
+
+namespace omelette::utils::Shapes {
+    // Fixed geometry built at compile time. A table lives in read-only data,
+    // so referencing it costs no allocation and no work at runtime.
+    template<size_t VertexCount, size_t IndexCount>
+    struct StaticMesh {
+        std::array<Vec3, VertexCount> vertices;
+        std::array<uint16_t, IndexCount> indices;
+    };
+
+    namespace detail {
+        /* Square Root
+        - Compile-time square root: Newton's method in double from above,
+          rounded once to float, which gives the same result as std::sqrt.
+        - Parameters:
+            - value: A non-negative, finite value.
+        - Returns: The square root of the value. */
+        constexpr float sqrt(float value) {
+            if (value == 0.0f) {
+                return 0.0f;
+            }
+            const double target = value;
+            double root = target > 1.0 ? target : 1.0;
+            for (int i = 0; i < 64; i++) {
+                const double next = 0.5 * (root + target / root);
+                if (next >= root) {
+                    break;
+                }
+                root = next;
+            }
+            return static_cast<float>(root);
+        }
+
+        /* Normalize
+        - Compile-time Vec3::normalize, with the same rounding steps.
+        - Parameters:
+            - v: A non-zero vector.
+        - Returns: The unit vector along v. */
+        constexpr Vec3 normalize(const Vec3& v) {
+            const float magnitude = sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+            return Vec3(v.x / magnitude, v.y / magnitude, v.z / magnitude);
+        }
+
+        /* Subdivide
+        - Compile-time version of one createIcosphere pass on the unit
+          sphere: each face is split in four and each edge midpoint pushed
+          onto the sphere. Vertices are created in the same order as at
+          runtime. Edges are looked up linearly, which is fine for the
+          small levels built here.
+        - Parameters:
+            - mesh: A closed triangle mesh on the unit sphere.
+        - Returns: The subdivided mesh, with one new vertex per edge. */
+        template<size_t VertexCount, size_t IndexCount>
+        constexpr StaticMesh<VertexCount + IndexCount / 2, IndexCount * 4>
+        subdivide(const StaticMesh<VertexCount, IndexCount>& mesh) {
+            StaticMesh<VertexCount + IndexCount / 2, IndexCount * 4> result{};
+            for (size_t i = 0; i < VertexCount; i++) {
+                result.vertices[i] = mesh.vertices[i];
+            }
+
+            // Ordered end points of each split edge; its midpoint is
+            // vertex VertexCount + edge index
+            std::array<uint32_t, IndexCount / 2> edgeKeys{};
+            size_t edgeCount = 0;
+
+            auto middle = [&](uint16_t a, uint16_t b) -> uint16_t {
+                const uint32_t key = a < b ? (uint32_t(a) << 16) | b
+                                           : (uint32_t(b) << 16) | a;
+                for (size_t edge = 0; edge < edgeCount; edge++) {
+                    if (edgeKeys[edge] == key) {
+                        return static_cast<uint16_t>(VertexCount + edge);
+                    }
+                }
+                const Vec3& p = result.vertices[a];
+                const Vec3& q = result.vertices[b];
+                result.vertices[VertexCount + edgeCount] = normalize(Vec3(
+                    (p.x + q.x) * 0.5f,
+                    (p.y + q.y) * 0.5f,
+                    (p.z + q.z) * 0.5f
+                ));
+                edgeKeys[edgeCount] = key;
+                return static_cast<uint16_t>(VertexCount + edgeCount++);
+            };
+
+            for (size_t i = 0; i < IndexCount; i += 3) {
+                const uint16_t a = mesh.indices[i];
+                const uint16_t b = mesh.indices[i + 1];
+                const uint16_t c = mesh.indices[i + 2];
+                const uint16_t ab = middle(a, b);
+                const uint16_t bc = middle(b, c);
+                const uint16_t ca = middle(c, a);
+
+                const uint16_t faces[12] =
+                    {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca};
+                for (size_t j = 0; j < 12; j++) {
+                    result.indices[i * 4 + j] = faces[j];
+                }
+            }
+            return result;
+        }
+
+        // Golden ratio, the icosahedron's vertex coordinate
+        inline constexpr float GOLDEN_RATIO = (1.0f + sqrt(5.0f)) / 2.0f;
+    } // namespace detail
+
+    // Cube with edges of length 1, centered on the origin
+    inline constexpr StaticMesh<8, 36> UNIT_CUBE = {
+        {
+            // Front face
+            Vec3(-0.5f, -0.5f, 0.5f), // 0
+            Vec3(0.5f, -0.5f, 0.5f), // 1
+            Vec3(0.5f, 0.5f, 0.5f), // 2
+            Vec3(-0.5f, 0.5f, 0.5f), // 3
+
+            // Back face
+            Vec3(-0.5f, -0.5f, -0.5f), // 4
+            Vec3(0.5f, -0.5f, -0.5f), // 5
+            Vec3(0.5f, 0.5f, -0.5f), // 6
+            Vec3(-0.5f, 0.5f, -0.5f) // 7
+        },
+        {
+            0, 1, 2, 2, 3, 0, // Front face
+            1, 5, 6, 6, 2, 1, // Right face
+            5, 4, 7, 7, 6, 5, // Back face
+            4, 0, 3, 3, 7, 4, // Left face
+            3, 2, 6, 6, 7, 3, // Top face
+            4, 5, 1, 1, 0, 4 // Bottom face
+        }
+    };
+
+    // Square in the XZ plane with edges of length 1, centered on the origin
+    inline constexpr StaticMesh<4, 6> UNIT_PLANE = {
+        {
+            Vec3(-0.5f, 0.0f, -0.5f), // 0
+            Vec3(0.5f, 0.0f, -0.5f), // 1
+            Vec3(0.5f, 0.0f, 0.5f), // 2
+            Vec3(-0.5f, 0.0f, 0.5f) // 3
+        },
+        {
+            0, 1, 2, // First triangle
+            2, 3, 0 // Second triangle
+        }
+    };
+
+    // Icosahedron inscribed in the unit sphere, the icosphere of level 0
+    inline constexpr StaticMesh<12, 60> ICOSAHEDRON = {
+        {
+            detail::normalize(Vec3(-1.0f, detail::GOLDEN_RATIO, 0.0f)),
+            detail::normalize(Vec3(1.0f, detail::GOLDEN_RATIO, 0.0f)),
+            detail::normalize(Vec3(-1.0f, -detail::GOLDEN_RATIO, 0.0f)),
+            detail::normalize(Vec3(1.0f, -detail::GOLDEN_RATIO, 0.0f)),
+
+            detail::normalize(Vec3(0.0f, -1.0f, detail::GOLDEN_RATIO)),
+            detail::normalize(Vec3(0.0f, 1.0f, detail::GOLDEN_RATIO)),
+            detail::normalize(Vec3(0.0f, -1.0f, -detail::GOLDEN_RATIO)),
+            detail::normalize(Vec3(0.0f, 1.0f, -detail::GOLDEN_RATIO)),
+
+            detail::normalize(Vec3(detail::GOLDEN_RATIO, 0.0f, -1.0f)),
+            detail::normalize(Vec3(detail::GOLDEN_RATIO, 0.0f, 1.0f)),
+            detail::normalize(Vec3(-detail::GOLDEN_RATIO, 0.0f, -1.0f)),
+            detail::normalize(Vec3(-detail::GOLDEN_RATIO, 0.0f, 1.0f))
+        },
+        {
+            0, 11, 5,  0, 5,  1, 0, 1, 7, 0, 7,  10, 0, 10, 11, 1, 5, 9, 5, 11,
+            4, 11, 10, 2, 10, 7, 6, 7, 1, 8, 3,  9,  4, 3,  4,  2, 3, 2, 6, 3,
+            6, 8,  3,  8, 9,  4, 9, 5, 2, 4, 11, 6,  2, 10, 8,  6, 7, 9, 8, 1
+        }
+    };
+
+    // Unit icospheres of levels 1 and 2, subdivided at compile time
+    inline constexpr auto ICOSPHERE_1 = detail::subdivide(ICOSAHEDRON);
+    inline constexpr auto ICOSPHERE_2 = detail::subdivide(ICOSPHERE_1);
+}; // namespace omelette::utils::Shapes
+
+#endif // OMELETTE_UTILS_SHAPETABLES_HPP
@@ -1,105 +1,88 @@
 #include "Shapes.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 #include <tuple>
+#include <utility>
 #include <vector>
 
+#include "FlatHashMap.hpp"
+#include "IndexBuffer.hpp"
+#include "Profiler.hpp"
+#include "ShapeTables.hpp"
+
 namespace omelette::utils::Shapes {
-    std::tuple<std::vector<Vec3>, std::vector<uintptr_t>>
-    createCube(float width, float height, float depth) {
-        float w = width * 0.5f;
-        float h = height * 0.5f;
-        float d = depth * 0.5f;
-
-        std::vector<Vec3> vertices = {
-            // Front face
-            Vec3(-w, -h, d), // 0
-            Vec3(w, -h, d), // 1
-            Vec3(w, h, d), // 2
-            Vec3(-w, h, d), // 3
-
-            // Back face
-            Vec3(-w, -h, -d), // 4
-            Vec3(w, -h, -d), // 5
-            Vec3(w, h, -d), // 6
-            Vec3(-w, h, -d) // 7
-        };
+    namespace {
+        // Throw if Index cannot address every vertex of a shape
+        template<typename Index>
+        void requireIndexFits(size_t vertexCount) {
+            if (!indexFits<Index>(vertexCount)) {
+                throw std::length_error(
+                    "Shapes: too many vertices for the index type"
+                );
+            }
+        }
 
-        std::vector<uintptr_t> indices = {// Front face
-                                          0,
-                                          1,
-                                          2,
-                                          2,
-                                          3,
-                                          0,
-                                          // Right face
-                                          1,
-                                          5,
-                                          6,
-                                          6,
-                                          2,
-                                          1,
-                                          // Back face
-                                          5,
-                                          4,
-                                          7,
-                                          7,
-                                          6,
-                                          5,
-                                          // Left face
-                                          4,
-                                          0,
-                                          3,
-                                          3,
-                                          7,
-                                          4,
-                                          // Top face
-                                          3,
-                                          2,
-                                          6,
-                                          6,
-                                          7,
-                                          3,
-                                          // Bottom face
-                                          4,
-                                          5,
-                                          1,
-                                          1,
-                                          0,
-                                          4
-        };
+        // Append a compile-time table to a mesh, scaling its vertices
+        // along each axis
+        template<typename Index, size_t VertexCount, size_t IndexCount>
+        void appendTable(
+            const StaticMesh<VertexCount, IndexCount>& table,
+            const Vec3& scale,
+            std::vector<Vec3>& vertices,
+            std::vector<Index>& indices
+        ) {
+            for (const Vec3& vertex : table.vertices) {
+                vertices.emplace_back(
+                    vertex.x * scale.x,
+                    vertex.y * scale.y,
+                    vertex.z * scale.z
+                );
+            }
+            indices.insert(
+                indices.end(),
+                table.indices.begin(),
+                table.indices.end()
+            );
+        }
+    } // namespace
 
-        return {vertices, indices};
+    template<typename Index>
+    std::tuple<std::vector<Vec3>, std::vector<Index>>
+    createCube(float width, float height, float depth) {
+        OMELETTE_PROFILE_ZONE("Shapes::createCube");
+        std::vector<Vec3> vertices;
+        std::vector<Index> indices;
+        vertices.reserve(UNIT_CUBE.vertices.size());
+        indices.reserve(UNIT_CUBE.indices.size());
+        appendTable(UNIT_CUBE, Vec3(width, height, depth), vertices, indices);
+        return {std::move(vertices), std::move(indices)};
     }
 
-    std::tuple<std::vector<Vec3>, std::vector<uintptr_t>>
+    template<typename Index>
+    std::tuple<std::vector<Vec3>, std::vector<Index>>
     createPlane(float width, float depth) {
-        float w = width * 0.5f;
-        float d = depth * 0.5f;
-
-        std::vector<Vec3> vertices = {
-            Vec3(-w, 0, -d), // 0
-            Vec3(w, 0, -d), // 1
-            Vec3(w, 0, d), // 2
-            Vec3(-w, 0, d) // 3
-        };
-
-        std::vector<uintptr_t> indices = {
-            0,
-            1,
-            2, // First triangle
-            2,
-            3,
-            0 // Second triangle
-        };
-
-        return {vertices, indices};
+        OMELETTE_PROFILE_ZONE("Shapes::createPlane");
+        std::vector<Vec3> vertices;
+        std::vector<Index> indices;
+        vertices.reserve(UNIT_PLANE.vertices.size());
+        indices.reserve(UNIT_PLANE.indices.size());
+        appendTable(UNIT_PLANE, Vec3(width, 1.0f, depth), vertices, indices);
+        return {std::move(vertices), std::move(indices)};
     }
 
-    std::tuple<std::vector<Vec3>, std::vector<uintptr_t>>
+    template<typename Index>
+    std::tuple<std::vector<Vec3>, std::vector<Index>>
     createUVSphere(float radius, unsigned int segments, unsigned int rings) {
+        OMELETTE_PROFILE_ZONE("Shapes::createUVSphere");
+        const size_t vertexCount = uvSphereVertexCount(segments, rings);
+        requireIndexFits<Index>(vertexCount);
+
         std::vector<Vec3> vertices;
-        std::vector<uintptr_t> indices;
+        std::vector<Index> indices;
+        vertices.reserve(vertexCount);
+        indices.reserve(size_t(rings) * segments * 6);
 
         // Generate vertices
         for (unsigned int ring = 0; ring <= rings; ring++) {
@@ -118,8 +101,9 @@ namespace omelette::utils::Shapes {
         // Generate indices
         for (unsigned int ring = 0; ring < rings; ring++) {
             for (unsigned int segment = 0; segment < segments; segment++) {
-                uintptr_t current = ring * (segments + 1) + segment;
-                uintptr_t next = current + segments + 1;
+                const Index current =
+                    static_cast<Index>(ring * (segments + 1) + segment);
+                const Index next = static_cast<Index>(current + segments + 1);
 
                 indices.push_back(current);
                 indices.push_back(next);
@@ -131,98 +115,106 @@ namespace omelette::utils::Shapes {
             }
         }
 
-        return {vertices, indices};
+        return {std::move(vertices), std::move(indices)};
     }
 
-    std::tuple<std::vector<Vec3>, std::vector<uintptr_t>>
+    template<typename Index>
+    std::tuple<std::vector<Vec3>, std::vector<Index>>
     createIcosphere(float radius, unsigned int subdivisions) {
-        // Start with icosahedron vertices
-        const float t = (1.0f + std::sqrt(5.0f)) / 2.0f;
-
-        std::vector<Vec3> vertices = {
-            Vec3(-1, t, 0).normalize() * radius,
-            Vec3(1, t, 0).normalize() * radius,
-            Vec3(-1, -t, 0).normalize() * radius,
-            Vec3(1, -t, 0).normalize() * radius,
-
-            Vec3(0, -1, t).normalize() * radius,
-            Vec3(0, 1, t).normalize() * radius,
-            Vec3(0, -1, -t).normalize() * radius,
-            Vec3(0, 1, -t).normalize() * radius,
-
-            Vec3(t, 0, -1).normalize() * radius,
-            Vec3(t, 0, 1).normalize() * radius,
-            Vec3(-t, 0, -1).normalize() * radius,
-            Vec3(-t, 0, 1).normalize() * radius
-        };
+        OMELETTE_PROFILE_ZONE("Shapes::createIcosphere");
+        requireIndexFits<Index>(icosphereVertexCount(subdivisions));
 
-        // Initial icosahedron faces
-        std::vector<uintptr_t> indices = {
-            0, 11, 5,  0, 5,  1, 0, 1, 7, 0, 7,  10, 0, 10, 11, 1, 5, 9, 5, 11,
-            4, 11, 10, 2, 10, 7, 6, 7, 1, 8, 3,  9,  4, 3,  4,  2, 3, 2, 6, 3,
-            6, 8,  3,  8, 9,  4, 9, 5, 2, 4, 11, 6,  2, 10, 8,  6, 7, 9, 8, 1
-        };
+        // Final sizes in closed form: every pass splits each face in four
+        // and adds one vertex per edge, so level n has 20 * 4^n faces and
+        // 10 * 4^n + 2 vertices
+        const size_t finalFaces = size_t(20) << (2 * subdivisions);
+        std::vector<Vec3> vertices;
+        std::vector<Index> indices;
+        vertices.reserve(finalFaces / 2 + 2);
+        indices.reserve(finalFaces * 3);
+
+        // Start from the deepest level built at compile time
+        const Vec3 scale(radius, radius, radius);
+        unsigned int level = std::min(subdivisions, 2u);
+        if (level == 0) {
+            appendTable(ICOSAHEDRON, scale, vertices, indices);
+        } else if (level == 1) {
+            appendTable(ICOSPHERE_1, scale, vertices, indices);
+        } else {
+            appendTable(ICOSPHERE_2, scale, vertices, indices);
+        }
 
-        // Helper function to get middle point of two vertices
-        auto getMiddlePoint =
-            [&vertices, radius](uintptr_t p1, uintptr_t p2) -> uintptr_t {
-            Vec3 middle = (vertices[p1] + vertices[p2]) * 0.5f;
-            middle = middle.normalize() * radius;
+        std::vector<Index> newIndices;
+        newIndices.reserve(finalFaces * 3);
 
-            // Check if we already have this vertex
-            for (size_t i = 0; i < vertices.size(); i++) {
-                if ((vertices[i] - middle).magnitude() < 0.00001f) {
-                    return i;
-                }
+        // Midpoint vertex of each edge split in the current pass, keyed by
+        // the edge's ordered vertex pair. A flat table, so once reserved
+        // for a pass, adding an edge never allocates.
+        FlatHashMap<uint64_t, Index> midpoints;
+
+        // Helper function to get middle point of two vertices
+        auto getMiddlePoint = [&](Index p1, Index p2) -> Index {
+            const uint64_t key = p1 < p2
+                ? (uint64_t(p1) << 32) | uint64_t(p2)
+                : (uint64_t(p2) << 32) | uint64_t(p1);
+            if (const Index* found = midpoints.find(key)) {
+                return *found;
             }
 
-            vertices.push_back(middle);
-            return vertices.size() - 1;
+            Vec3 middle = (vertices[p1] + vertices[p2]) * 0.5f;
+            vertices.push_back(middle.normalize() * radius);
+            const Index middleIndex = static_cast<Index>(vertices.size() - 1);
+            midpoints[key] = middleIndex;
+            return middleIndex;
         };
 
-        // Perform subdivisions
-        for (unsigned int i = 0; i < subdivisions; i++) {
-            std::vector<uintptr_t> newIndices;
+        // Size the table once for the last pass, the one splitting the
+        // most edges: its input has finalFaces / 4 faces, and each edge is
+        // shared by two of their 3 * finalFaces / 4 face edges
+        if (level < subdivisions) {
+            midpoints.reserve(finalFaces * 3 / 8);
+        }
+
+        // Perform the remaining subdivisions
+        for (; level < subdivisions; level++) {
+            midpoints.clear();
+            newIndices.clear();
 
             // Subdivide each triangle into 4 triangles
             for (size_t j = 0; j < indices.size(); j += 3) {
-                uintptr_t a = indices[j];
-                uintptr_t b = indices[j + 1];
-                uintptr_t c = indices[j + 2];
+                Index a = indices[j];
+                Index b = indices[j + 1];
+                Index c = indices[j + 2];
 
                 // Get middle points
-                uintptr_t ab = getMiddlePoint(a, b);
-                uintptr_t bc = getMiddlePoint(b, c);
-                uintptr_t ca = getMiddlePoint(c, a);
+                Index ab = getMiddlePoint(a, b);
+                Index bc = getMiddlePoint(b, c);
+                Index ca = getMiddlePoint(c, a);
 
                 // Add four triangles
-                newIndices.push_back(a);
-                newIndices.push_back(ab);
-                newIndices.push_back(ca);
-
-                newIndices.push_back(b);
-                newIndices.push_back(bc);
-                newIndices.push_back(ab);
-
-                newIndices.push_back(c);
-                newIndices.push_back(ca);
-                newIndices.push_back(bc);
-
-                newIndices.push_back(ab);
-                newIndices.push_back(bc);
-                newIndices.push_back(ca);
+                newIndices.insert(
+                    newIndices.end(),
+                    {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca}
+                );
             }
 
-            indices = newIndices;
+            indices.swap(newIndices);
         }
 
-        return {vertices, indices};
+        return {std::move(vertices), std::move(indices)};
     }
 
-    std::tuple<std::vector<Vec3>, std::vector<uintptr_t>>
+    template<typename Index>
+    std::tuple<std::vector<Vec3>, std::vector<Index>>
     createCylinder(float radius, float height, unsigned int segments) {
+        OMELETTE_PROFILE_ZONE("Shapes::createCylinder");
+        const size_t vertexCount = cylinderVertexCount(segments);
+        requireIndexFits<Index>(vertexCount);
+
         std::vector<Vec3> vertices;
-        std::vector<uintptr_t> indices;
+        std::vector<Index> indices;
+        vertices.reserve(vertexCount);
+        indices.reserve(size_t(segments) * 12);
 
         float halfHeight = height * 0.5f;
 
@@ -242,10 +234,10 @@ namespace omelette::utils::Shapes {
 
         // Generate indices for the sides
         for (unsigned int i = 0; i < segments; i++) {
-            uintptr_t bottomFirst = 2 + (i * 2);
-            uintptr_t bottomSecond = bottomFirst + 2;
-            uintptr_t topFirst = bottomFirst + 1;
-            uintptr_t topSecond = bottomSecond + 1;
+            const Index bottomFirst = static_cast<Index>(2 + (i * 2));
+            const Index bottomSecond = static_cast<Index>(bottomFirst + 2);
+            const Index topFirst = static_cast<Index>(bottomFirst + 1);
+            const Index topSecond = static_cast<Index>(bottomSecond + 1);
 
             // Side faces
             indices.push_back(bottomFirst);
@@ -267,7 +259,49 @@ namespace omelette::utils::Shapes {
             indices.push_back(topFirst);
         }
 
-        return {vertices, indices};
+        return {std::move(vertices), std::move(indices)};
     }
 
+    /* UV Sphere Vertex Count
+    - Returns: The number of vertices of createUVSphere: one per segment
+      plus a seam vertex, on each ring and both poles. */
+    size_t uvSphereVertexCount(unsigned int segments, unsigned int rings) {
+        return (size_t(rings) + 1) * (size_t(segments) + 1);
+    }
+
+    /* Icosphere Vertex Count
+    - Returns: The number of vertices of createIcosphere, 10 * 4^n + 2. */
+    size_t icosphereVertexCount(unsigned int subdivisions) {
+        return (size_t(10) << (2 * subdivisions)) + 2;
+    }
+
+    /* Cylinder Vertex Count
+    - Returns: The number of vertices of createCylinder: two ring vertices
+      per segment plus the seam, and the two cap centers. */
+    size_t cylinderVertexCount(unsigned int segments) {
+        return 2 * (size_t(segments) + 1) + 2;
+    }
+
+    // The supported index types
+    template std::tuple<std::vector<Vec3>, std::vector<uint16_t>>
+    createCube<uint16_t>(float, float, float);
+    template std::tuple<std::vector<Vec3>, std::vector<uint32_t>>
+    createCube<uint32_t>(float, float, float);
+    template std::tuple<std::vector<Vec3>, std::vector<uint16_t>>
+    createPlane<uint16_t>(float, float);
+    template std::tuple<std::vector<Vec3>, std::vector<uint32_t>>
+    createPlane<uint32_t>(float, float);
+    template std::tuple<std::vector<Vec3>, std::vector<uint16_t>>
+    createUVSphere<uint16_t>(float, unsigned int, unsigned int);
+    template std::tuple<std::vector<Vec3>, std::vector<uint32_t>>
+    createUVSphere<uint32_t>(float, unsigned int, unsigned int);
+    template std::tuple<std::vector<Vec3>, std::vector<uint16_t>>
+    createIcosphere<uint16_t>(float, unsigned int);
+    template std::tuple<std::vector<Vec3>, std::vector<uint32_t>>
+    createIcosphere<uint32_t>(float, unsigned int);
+    template std::tuple<std::vector<Vec3>, std::vector<uint16_t>>
+    createCylinder<uint16_t>(float, float, unsigned int);
+    template std::tuple<std::vector<Vec3>, std::vector<uint32_t>>
+    createCylinder<uint32_t>(float, float, unsigned int);
+
 } // namespace omelette::utils::Shapes
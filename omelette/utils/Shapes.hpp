@@ -1,6 +1,7 @@
 #ifndef OMELLETE_UTILS_SHAPES_HPP
 #define OMELLETE_UTILS_SHAPES_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 #include <vector>
@@ -8,34 +9,49 @@
 #include "Vec3.hpp"
 
 namespace omelette::utils::Shapes {
+    // Every generator returns vertices and a triangle list of indices of
+    // type Index, which may be uint16_t or uint32_t. A 16-bit index type
+    // throws std::length_error if the shape has more than 65536 vertices.
+
     // Cube / Rectangular Prism
-    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<uintptr_t>>
+    template<typename Index = uint32_t>
+    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<Index>>
     createCube(float width = 1.0f, float height = 1.0f, float depth = 1.0f);
 
     // Plane
-    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<uintptr_t>>
+    template<typename Index = uint32_t>
+    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<Index>>
     createPlane(float width = 1.0f, float depth = 1.0f);
 
     // Sphere (UV)
-    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<uintptr_t>>
+    template<typename Index = uint32_t>
+    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<Index>>
     createUVSphere(
         float radius = 1.0f,
         unsigned int segments = 16,
         unsigned int rings = 16
     );
 
-    // Sphere (Icosphere)
-    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<uintptr_t>>
+    // Sphere (Icosphere), with 10 * 4^subdivisions + 2 vertices
+    template<typename Index = uint32_t>
+    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<Index>>
     createIcosphere(float radius = 1.0f, unsigned int subdivisions = 1);
 
     // Cylinder
-    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<uintptr_t>>
+    template<typename Index = uint32_t>
+    std::tuple<std::vector<omelette::utils::Vec3>, std::vector<Index>>
     createCylinder(
         float radius = 1.0f,
         float height = 1.0f,
         unsigned int segments = 16
     );
 
+    // Number of vertices each generator makes, to pick an index type
+    // before generating
+    size_t uvSphereVertexCount(unsigned int segments, unsigned int rings);
+    size_t icosphereVertexCount(unsigned int subdivisions);
+    size_t cylinderVertexCount(unsigned int segments);
+
 } // namespace omelette::utils::Shapes
 
 #endif
@@ -0,0 +1,29 @@
+#include "Simd.hpp"
+
+namespace omelette::utils {
+    namespace {
+        /* Detect SIMD Level
+        - Queries the running CPU for the best supported kernel. */
+        SimdLevel detectSimdLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx")) {
+                return SimdLevel::AVX;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return SimdLevel::SSE2;
+            }
+#endif
+            return SimdLevel::Scalar;
+        }
+    } // namespace
+
+    /* Get SIMD Level
+    - Returns the best instruction set supported by the running CPU. The
+      result is detected once and cached.
+    - Returns: The SIMD level the kernels dispatch to by default. */
+    SimdLevel getSimdLevel() {
+        static const SimdLevel level = detectSimdLevel();
+        return level;
+    }
+}; // namespace omelette::utils
@@ -0,0 +1,12 @@
+#ifndef OMELETTE_UTILS_SIMD_HPP
+#define OMELETTE_UTILS_SIMD_HPP
+
+namespace omelette::utils {
+    // Instruction set used by the SIMD kernels
+    enum class SimdLevel { Scalar, SSE2, AVX };
+
+    // Best instruction set supported by the running CPU, detected once
+    SimdLevel getSimdLevel();
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_SIMD_HPP
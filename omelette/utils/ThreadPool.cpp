@@ -0,0 +1,230 @@
+#include "ThreadPool.hpp"
+
+namespace omelette::utils {
+    namespace {
+        // Pool and worker index of the current thread, if it is a worker
+        thread_local const ThreadPool* currentPool = nullptr;
+        thread_local size_t currentWorker = 0;
+    } // namespace
+
+    /* ThreadPool Constructor
+    - Spawns the worker threads.
+    - Parameters:
+        - threadCount: Threads to run tasks on, including the calling thread.
+          Zero uses std::thread::hardware_concurrency(). */
+    ThreadPool::ThreadPool(size_t threadCount) {
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        const size_t workerCount = threadCount - 1;
+        for (size_t i = 0; i <= workerCount; i++) {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++) {
+            workers.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    /* ThreadPool Destructor
+    - Stops and joins the worker threads. Queued tasks are abandoned. */
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        sleepCondition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /* Get Thread Count
+    - Returns: The number of threads running tasks, including the caller. */
+    size_t ThreadPool::getThreadCount() const {
+        return workers.size() + 1;
+    }
+
+    /* Current Queue
+    - Returns: The calling worker's own queue, or the shared queue for
+      threads outside the pool. */
+    size_t ThreadPool::currentQueue() const {
+        return currentPool == this ? currentWorker : queues.size() - 1;
+    }
+
+    /* Submit
+    - Queues a task on the calling thread's queue.
+    - Parameters:
+        - task: The task to run.
+        - group: The group the task belongs to. */
+    void ThreadPool::submit(Task task, TaskGroup& group) {
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+
+        auto& queue = *queues[currentQueue()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.pushBack(std::move(task), &group);
+        }
+        queuedCount.fetch_add(1, std::memory_order_release);
+
+        // Take the sleep lock so a worker between its check and its wait
+        // can not miss the notification
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        sleepCondition.notify_one();
+    }
+
+    /* Wait
+    - Runs queued tasks on the calling thread until a group has finished,
+      then rethrows the first exception a task of the group threw. Tasks
+      of other groups run here keep their exceptions in their own group.
+    - Parameters:
+        - group: The group to wait for. */
+    void ThreadPool::wait(TaskGroup& group) {
+        const size_t queueIndex = currentQueue();
+        std::pair<Task, TaskGroup*> task;
+        while (!group.isDone()) {
+            if (findTask(queueIndex, task)) {
+                runTask(task);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        group.rethrowIfFailed();
+    }
+
+    /* Pop Task
+    - Takes one task from a queue.
+    - Parameters:
+        - queueIndex: The queue to take from.
+        - steal: Take the oldest task instead of the newest.
+        - task: Receives the task.
+    - Returns: True if a task was taken. */
+    bool ThreadPool::popTask(
+        size_t queueIndex,
+        bool steal,
+        std::pair<Task, TaskGroup*>& task
+    ) {
+        auto& queue = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.count == 0) {
+            return false;
+        }
+
+        if (steal) {
+            queue.popFront(task);
+        } else {
+            queue.popBack(task);
+        }
+        queuedCount.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /* Push Back
+    - Appends a task, doubling the ring when it is full.
+    - Parameters:
+        - task: The task to queue.
+        - group: The group the task belongs to. */
+    void ThreadPool::WorkQueue::pushBack(Task&& task, TaskGroup* group) {
+        if (count == tasks.size()) {
+            std::vector<std::pair<Task, TaskGroup*>> grown(
+                std::max<size_t>(16, tasks.size() * 2)
+            );
+            for (size_t i = 0; i < count; i++) {
+                grown[i] = std::move(tasks[(head + i) % tasks.size()]);
+            }
+            tasks = std::move(grown);
+            head = 0;
+        }
+        auto& slot = tasks[(head + count) % tasks.size()];
+        slot.first = std::move(task);
+        slot.second = group;
+        count++;
+    }
+
+    /* Pop Back
+    - Removes the newest task. The queue must not be empty.
+    - Parameters:
+        - task: Receives the task. */
+    void ThreadPool::WorkQueue::popBack(std::pair<Task, TaskGroup*>& task) {
+        count--;
+        task = std::move(tasks[(head + count) % tasks.size()]);
+    }
+
+    /* Pop Front
+    - Removes the oldest task. The queue must not be empty.
+    - Parameters:
+        - task: Receives the task. */
+    void ThreadPool::WorkQueue::popFront(std::pair<Task, TaskGroup*>& task) {
+        task = std::move(tasks[head]);
+        head = (head + 1) % tasks.size();
+        count--;
+    }
+
+    /* Find Task
+    - Pops from the given queue, then tries to steal from every other one.
+    - Parameters:
+        - queueIndex: The queue owned by the calling thread.
+        - task: Receives the task.
+    - Returns: True if a task was found. */
+    bool ThreadPool::findTask(
+        size_t queueIndex,
+        std::pair<Task, TaskGroup*>& task
+    ) {
+        if (queuedCount.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        if (popTask(queueIndex, false, task)) {
+            return true;
+        }
+        for (size_t i = 1; i < queues.size(); i++) {
+            if (popTask((queueIndex + i) % queues.size(), true, task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* Run Task
+    - Runs a task and marks it finished in its group. An exception thrown
+      by the task is kept in the group for wait() to rethrow, so it never
+      escapes a worker thread and the group always drains.
+    - Parameters:
+        - task: The task to run. */
+    void ThreadPool::runTask(std::pair<Task, TaskGroup*>& task) {
+        try {
+            task.first();
+        } catch (...) {
+            task.second->fail(std::current_exception());
+        }
+        task.first = nullptr;
+        task.second->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /* Worker Loop
+    - Runs tasks until the pool is destroyed, sleeping while none are queued.
+    - Parameters:
+        - workerIndex: Index of the worker's own queue. */
+    void ThreadPool::workerLoop(size_t workerIndex) {
+        currentPool = this;
+        currentWorker = workerIndex;
+
+        std::pair<Task, TaskGroup*> task;
+        while (true) {
+            if (findTask(workerIndex, task)) {
+                runTask(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepCondition.wait(lock, [this]() {
+                return stopping
+                    || queuedCount.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+}; // namespace omelette::utils
@@ -0,0 +1,181 @@
+#ifndef OMELETTE_UTILS_THREADPOOL_HPP
+#define OMELETTE_UTILS_THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace omelette::utils {
+    // Counter of outstanding tasks that a thread can wait on, holding the
+    // first exception any of them threw until the waiter rethrows it
+    class TaskGroup {
+      private:
+        std::atomic<bool> failed{false}; // Whether exception is set
+        std::exception_ptr exception; // First exception thrown by a task
+
+      public:
+        std::atomic<size_t> pending{0}; // Tasks submitted but not finished
+
+        // Whether every submitted task has finished
+        bool isDone() const {
+            return pending.load(std::memory_order_acquire) == 0;
+        }
+
+        // Keep an exception unless an earlier one is already kept. Called
+        // before the failed task decrements pending, which publishes it.
+        void fail(std::exception_ptr thrown) {
+            if (!failed.exchange(true, std::memory_order_relaxed)) {
+                exception = std::move(thrown);
+            }
+        }
+
+        // Rethrow the kept exception, if any, and clear it. Only valid once
+        // the group is done.
+        void rethrowIfFailed() {
+            if (failed.load(std::memory_order_relaxed)) {
+                std::exception_ptr thrown = std::move(exception);
+                exception = nullptr;
+                failed.store(false, std::memory_order_relaxed);
+                std::rethrow_exception(thrown);
+            }
+        }
+    };
+
+    // Work-stealing thread pool. Each worker owns a task deque: it pops its
+    // own newest task and steals the oldest task of another worker when it
+    // runs dry. Threads waiting on a task group run queued tasks instead of
+    // blocking, so tasks may submit and wait on nested work.
+    class ThreadPool {
+      public:
+        using Task = std::function<void()>;
+
+      private:
+        // Task deque of one worker, a ring buffer that keeps its storage
+        // so queueing tasks does not allocate once the pool is warm
+        struct WorkQueue {
+            std::mutex mutex;
+            std::vector<std::pair<Task, TaskGroup*>> tasks; // Ring storage
+            size_t head = 0; // Slot of the oldest task
+            size_t count = 0; // Number of queued tasks
+
+            void pushBack(Task&& task, TaskGroup* group);
+            void popBack(std::pair<Task, TaskGroup*>& task);
+            void popFront(std::pair<Task, TaskGroup*>& task);
+        };
+
+        // One queue per worker, plus one for threads outside the pool
+        std::vector<std::unique_ptr<WorkQueue>> queues;
+
+        // Worker threads
+        std::vector<std::thread> workers;
+
+        // Number of queued tasks across all queues
+        std::atomic<size_t> queuedCount{0};
+
+        // Sleep/wake-up of idle workers
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+        bool stopping = false;
+
+        // Worker main loop
+        void workerLoop(size_t workerIndex);
+
+        // Pop a task from a queue's back (owner) or front (thief)
+        bool popTask(
+            size_t queueIndex,
+            bool steal,
+            std::pair<Task, TaskGroup*>& task
+        );
+
+        // Find a task, preferring the given queue, then stealing
+        bool findTask(size_t queueIndex, std::pair<Task, TaskGroup*>& task);
+
+        // Run a task and mark it finished in its group
+        static void runTask(std::pair<Task, TaskGroup*>& task);
+
+        // Queue used by the calling thread
+        size_t currentQueue() const;
+
+      public:
+        // Create a pool; threadCount counts the calling thread, so the pool
+        // spawns threadCount - 1 workers. Zero uses every hardware thread.
+        explicit ThreadPool(size_t threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Number of threads executing tasks, including the calling thread
+        size_t getThreadCount() const;
+
+        // Queue a task as part of a group
+        void submit(Task task, TaskGroup& group);
+
+        // Run queued tasks until every task of the group has finished, then
+        // rethrow the first exception a task of the group threw
+        void wait(TaskGroup& group);
+
+        // Split [0, count) into chunks of at least grainSize items and run
+        // function(begin, end) for each chunk in parallel. If chunks throw,
+        // every chunk still finishes before the first exception propagates.
+        template<typename Function>
+        void parallelFor(size_t count, size_t grainSize, Function&& function);
+    };
+
+    /* Parallel For
+    - Splits a range into chunks and runs them across the pool. The calling
+      thread runs chunks too and returns once every chunk has finished.
+      The first exception thrown by a chunk is rethrown after that.
+    - Parameters:
+        - count: The number of items in the range.
+        - grainSize: The minimum number of items per chunk.
+        - function: Called as function(begin, end) for each chunk. */
+    template<typename Function>
+    void ThreadPool::parallelFor(
+        size_t count,
+        size_t grainSize,
+        Function&& function
+    ) {
+        if (count == 0) {
+            return;
+        }
+
+        grainSize = std::max<size_t>(grainSize, 1);
+        const size_t maxChunks = getThreadCount() * 4;
+        const size_t chunkSize =
+            std::max(grainSize, (count + maxChunks - 1) / maxChunks);
+
+        if (chunkSize >= count) {
+            function(size_t(0), count);
+            return;
+        }
+
+        // Tasks capture only the chunk's start and a reference, so they fit
+        // in std::function's inline storage and submitting never allocates
+        const auto runChunk = [&function, chunkSize, count](size_t begin) {
+            function(begin, std::min(begin + chunkSize, count));
+        };
+
+        TaskGroup group;
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+            submit([&runChunk, begin]() { runChunk(begin); }, group);
+        }
+        // The chunks reference this frame, so they must all finish before
+        // an exception from the calling thread's chunk leaves it
+        try {
+            function(size_t(0), chunkSize);
+        } catch (...) {
+            group.fail(std::current_exception());
+        }
+        wait(group);
+    }
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_THREADPOOL_HPP
@@ -1,40 +1,45 @@
 #ifndef OMELETTE_UTILS_VEC3_HPP
 #define OMELETTE_UTILS_VEC3_HPP
 
+#include <cmath>
+
 namespace omelette::utils {
+    // Packed 3D vector. Every operation is defined inline below, so calls
+    // from the integrator and shape code compile down to plain arithmetic;
+    // everything except magnitude and normalize is also constexpr.
     class Vec3 {
       public:
         float x, y, z; // The x, y, and z coordinates of the vector
 
         // Default constructor
-        Vec3();
+        constexpr Vec3();
 
         // Parameterized constructor
-        Vec3(float x, float y, float z);
+        constexpr Vec3(float x, float y, float z);
 
         // Addition of two vectors
-        Vec3 operator+(const Vec3& other) const;
+        constexpr Vec3 operator+(const Vec3& other) const;
 
         // Subtraction of two vectors
-        Vec3 operator-(const Vec3& other) const;
+        constexpr Vec3 operator-(const Vec3& other) const;
 
         // Multiplication of vector by a scalar
-        Vec3 operator*(float scalar) const;
+        constexpr Vec3 operator*(float scalar) const;
 
         // Division of vector by a scalar
-        Vec3 operator/(float scalar) const;
+        constexpr Vec3 operator/(float scalar) const;
 
         // Compound addition of two vectors
-        Vec3 operator+=(const Vec3& other);
+        constexpr Vec3& operator+=(const Vec3& other);
 
         // Compound subtraction of two vectors
-        Vec3 operator-=(const Vec3& other);
+        constexpr Vec3& operator-=(const Vec3& other);
 
         // Dot product of two vectors
-        float dot(const Vec3& other) const;
+        constexpr float dot(const Vec3& other) const;
 
         // Cross product of two vectors
-        Vec3 cross(const Vec3& other) const;
+        constexpr Vec3 cross(const Vec3& other) const;
 
         // Magnitude (length) of the vector
         float magnitude() const;
@@ -43,8 +48,101 @@ namespace omelette::utils {
         Vec3 normalize() const;
 
         // Linear interpolation
-        static Vec3 lerp(const Vec3& start, const Vec3& end, float t);
+        static constexpr Vec3 lerp(const Vec3& start, const Vec3& end, float t);
     };
+
+    /* Vec3 Default Constructor
+    - Sets the Vector's x, y, and z components to 0. */
+    constexpr Vec3::Vec3() : x(0), y(0), z(0) {}
+
+    /* Vec3 Constructor
+    - Sets the Vector's x, y, and z components to the given values. */
+    constexpr Vec3::Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    /* Vec3 Addition Operator Overload
+    - Adds the x, y, and z components of the two vectors and returns the
+      result. */
+    constexpr Vec3 Vec3::operator+(const Vec3& other) const {
+        return Vec3(x + other.x, y + other.y, z + other.z);
+    }
+
+    /* Vec3 Subtraction Operator Overload
+    - Subtracts the x, y, and z components of the two vectors and returns
+      the result. */
+    constexpr Vec3 Vec3::operator-(const Vec3& other) const {
+        return Vec3(x - other.x, y - other.y, z - other.z);
+    }
+
+    /* Vec3 Scalar Multiplication Operator Overload
+    - Multiplies the x, y, and z components of the vector by the given
+      scalar and returns the result. */
+    constexpr Vec3 Vec3::operator*(float scalar) const {
+        return Vec3(x * scalar, y * scalar, z * scalar);
+    }
+
+    /* Vec3 Scalar Division Operator Overload
+    - Divides the x, y, and z components of the vector by the given scalar
+      and returns the result. */
+    constexpr Vec3 Vec3::operator/(float scalar) const {
+        return Vec3(x / scalar, y / scalar, z / scalar);
+    }
+
+    /* Vec3 Compound Addition Operator Overload
+    - Adds the x, y, and z components of the other vector to this one.
+    - Returns: A reference to this vector, so compound assignments chain
+      like the built-in ones. */
+    constexpr Vec3& Vec3::operator+=(const Vec3& other) {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+
+    /* Vec3 Compound Subtraction Operator Overload
+    - Subtracts the x, y, and z components of the other vector from this
+      one.
+    - Returns: A reference to this vector. */
+    constexpr Vec3& Vec3::operator-=(const Vec3& other) {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this;
+    }
+
+    /* Vec3 Dot Product
+    - Returns the dot product of the vector with another vector. */
+    constexpr float Vec3::dot(const Vec3& other) const {
+        return x * other.x + y * other.y + z * other.z;
+    }
+
+    /* Vec3 Cross Product
+    - Returns the cross product of the vector with another vector. */
+    constexpr Vec3 Vec3::cross(const Vec3& other) const {
+        return Vec3(
+            y * other.z - z * other.y,
+            z * other.x - x * other.z,
+            x * other.y - y * other.x
+        );
+    }
+
+    /* Vec3 Magnitude
+    - Returns the magnitude (length) of the vector. */
+    inline float Vec3::magnitude() const {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    /* Vec3 Normalization
+    - Returns the normalized vector (unit vector) of the vector. */
+    inline Vec3 Vec3::normalize() const {
+        float mag = magnitude();
+        return Vec3(x / mag, y / mag, z / mag);
+    }
+
+    /* Vec3 Lerp
+    - Linearly interpolates between two vectors by the given amount. */
+    constexpr Vec3 Vec3::lerp(const Vec3& start, const Vec3& end, float t) {
+        return start + (end - start) * t;
+    }
 }; // namespace omelette::utils
 
 #endif // OMELETTE_UTILS_VEC3_HPP
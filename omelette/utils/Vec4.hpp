@@ -0,0 +1,304 @@
+#ifndef OMELETTE_UTILS_VEC4_HPP
+#define OMELETTE_UTILS_VEC4_HPP
+
+#include <cmath>
+
+#include "Vec3.hpp"
+
+#if defined(__SSE__) || defined(_M_X64)
+    #define OMELETTE_VEC4_SSE 1
+    #include <xmmintrin.h>
+#endif
+
+namespace omelette::utils {
+    namespace detail {
+        // Four float lanes, an SSE register when available. The vector
+        // classes below are written against these helpers only.
+#ifdef OMELETTE_VEC4_SSE
+        using Lanes = __m128;
+
+        inline Lanes load(const float* from) {
+            return _mm_load_ps(from);
+        }
+        inline void store(float* to, Lanes value) {
+            _mm_store_ps(to, value);
+        }
+        inline Lanes splat(float value) {
+            return _mm_set1_ps(value);
+        }
+        inline Lanes add(Lanes a, Lanes b) {
+            return _mm_add_ps(a, b);
+        }
+        inline Lanes sub(Lanes a, Lanes b) {
+            return _mm_sub_ps(a, b);
+        }
+        inline Lanes mul(Lanes a, Lanes b) {
+            return _mm_mul_ps(a, b);
+        }
+        inline Lanes div(Lanes a, Lanes b) {
+            return _mm_div_ps(a, b);
+        }
+        inline Lanes sqrt(Lanes a) {
+            return _mm_sqrt_ps(a);
+        }
+
+        // Sum of the four lane products, in every lane
+        inline Lanes dot(Lanes a, Lanes b) {
+            const Lanes products = _mm_mul_ps(a, b);
+            const Lanes pairs = _mm_add_ps(
+                products,
+                _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 3, 0, 1))
+            );
+            return _mm_add_ps(
+                pairs,
+                _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2))
+            );
+        }
+
+        // Cross product of lanes 0-2; lane 3 becomes 0 if it is finite
+        inline Lanes cross(Lanes a, Lanes b) {
+            const Lanes aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+            const Lanes bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+            const Lanes zxy =
+                _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+            return _mm_shuffle_ps(zxy, zxy, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+
+        // Reciprocal square root: the hardware estimate refined by one
+        // Newton-Raphson step, to about 22 bits
+        inline Lanes rsqrtFast(Lanes a) {
+            const Lanes estimate = _mm_rsqrt_ps(a);
+            const Lanes correction = _mm_sub_ps(
+                _mm_set1_ps(1.5f),
+                _mm_mul_ps(
+                    _mm_mul_ps(_mm_set1_ps(0.5f), a),
+                    _mm_mul_ps(estimate, estimate)
+                )
+            );
+            return _mm_mul_ps(estimate, correction);
+        }
+
+        // First lane of a register
+        inline float first(Lanes value) {
+            return _mm_cvtss_f32(value);
+        }
+#else
+        struct Lanes {
+            float v[4];
+        };
+
+        inline Lanes load(const float* from) {
+            return {{from[0], from[1], from[2], from[3]}};
+        }
+        inline void store(float* to, Lanes value) {
+            for (int i = 0; i < 4; i++) {
+                to[i] = value.v[i];
+            }
+        }
+        inline Lanes splat(float value) {
+            return {{value, value, value, value}};
+        }
+        inline Lanes add(Lanes a, Lanes b) {
+            return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2],
+                     a.v[3] + b.v[3]}};
+        }
+        inline Lanes sub(Lanes a, Lanes b) {
+            return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2],
+                     a.v[3] - b.v[3]}};
+        }
+        inline Lanes mul(Lanes a, Lanes b) {
+            return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2],
+                     a.v[3] * b.v[3]}};
+        }
+        inline Lanes div(Lanes a, Lanes b) {
+            return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2],
+                     a.v[3] / b.v[3]}};
+        }
+        inline Lanes sqrt(Lanes a) {
+            return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]),
+                     std::sqrt(a.v[3])}};
+        }
+        inline Lanes dot(Lanes a, Lanes b) {
+            return splat(
+                (a.v[0] * b.v[0] + a.v[1] * b.v[1])
+                + (a.v[2] * b.v[2] + a.v[3] * b.v[3])
+            );
+        }
+        inline Lanes cross(Lanes a, Lanes b) {
+            return {{a.v[1] * b.v[2] - a.v[2] * b.v[1],
+                     a.v[2] * b.v[0] - a.v[0] * b.v[2],
+                     a.v[0] * b.v[1] - a.v[1] * b.v[0],
+                     0.0f}};
+        }
+        inline Lanes rsqrtFast(Lanes a) {
+            return div(splat(1.0f), sqrt(a));
+        }
+        inline float first(Lanes value) {
+            return value.v[0];
+        }
+#endif
+    } // namespace detail
+
+    // 16-byte aligned 3D vector with a zero fourth lane, so each one is a
+    // single SSE register. Use it for math-heavy code; Vec3 stays the
+    // packed storage format for meshes.
+    class alignas(16) Vec3A {
+      public:
+        float x, y, z; // The x, y, and z coordinates of the vector
+        float w = 0.0f; // Padding lane, kept at 0 by every operation
+
+        // Default constructor
+        constexpr Vec3A() : x(0), y(0), z(0) {}
+
+        // Parameterized constructor
+        constexpr Vec3A(float x, float y, float z) : x(x), y(y), z(z) {}
+
+        // Conversions to and from the packed vector
+        constexpr explicit Vec3A(const Vec3& v) : x(v.x), y(v.y), z(v.z) {}
+        constexpr Vec3 toVec3() const {
+            return Vec3(x, y, z);
+        }
+
+        // Arithmetic, lane by lane
+        Vec3A operator+(const Vec3A& other) const {
+            return Vec3A(detail::add(lanes(), other.lanes()));
+        }
+        Vec3A operator-(const Vec3A& other) const {
+            return Vec3A(detail::sub(lanes(), other.lanes()));
+        }
+        Vec3A operator*(float scalar) const {
+            return Vec3A(detail::mul(lanes(), detail::splat(scalar)));
+        }
+        Vec3A operator/(float scalar) const {
+            return Vec3A(detail::div(lanes(), detail::splat(scalar)));
+        }
+        Vec3A& operator+=(const Vec3A& other) {
+            return *this = *this + other;
+        }
+        Vec3A& operator-=(const Vec3A& other) {
+            return *this = *this - other;
+        }
+
+        // Dot and cross products
+        float dot(const Vec3A& other) const {
+            return detail::first(detail::dot(lanes(), other.lanes()));
+        }
+        Vec3A cross(const Vec3A& other) const {
+            return Vec3A(detail::cross(lanes(), other.lanes()));
+        }
+
+        // Magnitude (length) of the vector
+        float magnitude() const {
+            return std::sqrt(dot(*this));
+        }
+
+        // Unit vector, exact to rounding
+        Vec3A normalize() const {
+            const detail::Lanes v = lanes();
+            return Vec3A(detail::div(v, detail::sqrt(detail::dot(v, v))));
+        }
+
+        // Unit vector from the reciprocal square root estimate, accurate to
+        // a few units in the last place; for normals and directions
+        Vec3A normalizeFast() const {
+            const detail::Lanes v = lanes();
+            return Vec3A(detail::mul(v, detail::rsqrtFast(detail::dot(v, v))));
+        }
+
+        // Linear interpolation
+        static Vec3A lerp(const Vec3A& start, const Vec3A& end, float t) {
+            return start + (end - start) * t;
+        }
+
+      private:
+        explicit Vec3A(detail::Lanes value) {
+            detail::store(&x, value);
+        }
+
+        detail::Lanes lanes() const {
+            return detail::load(&x);
+        }
+    };
+
+    // 16-byte aligned 4D vector, one SSE register
+    class alignas(16) Vec4 {
+      public:
+        float x, y, z, w; // The x, y, z, and w coordinates of the vector
+
+        // Default constructor
+        constexpr Vec4() : x(0), y(0), z(0), w(0) {}
+
+        // Parameterized constructor
+        constexpr Vec4(float x, float y, float z, float w) :
+            x(x),
+            y(y),
+            z(z),
+            w(w) {}
+
+        // Extend a 3D vector, e.g. with w = 1 for a point
+        constexpr Vec4(const Vec3& v, float w) : x(v.x), y(v.y), z(v.z), w(w) {}
+
+        // The x, y, and z coordinates
+        constexpr Vec3 toVec3() const {
+            return Vec3(x, y, z);
+        }
+
+        // Arithmetic, lane by lane
+        Vec4 operator+(const Vec4& other) const {
+            return Vec4(detail::add(lanes(), other.lanes()));
+        }
+        Vec4 operator-(const Vec4& other) const {
+            return Vec4(detail::sub(lanes(), other.lanes()));
+        }
+        Vec4 operator*(float scalar) const {
+            return Vec4(detail::mul(lanes(), detail::splat(scalar)));
+        }
+        Vec4 operator/(float scalar) const {
+            return Vec4(detail::div(lanes(), detail::splat(scalar)));
+        }
+        Vec4& operator+=(const Vec4& other) {
+            return *this = *this + other;
+        }
+        Vec4& operator-=(const Vec4& other) {
+            return *this = *this - other;
+        }
+
+        // Dot product over all four lanes
+        float dot(const Vec4& other) const {
+            return detail::first(detail::dot(lanes(), other.lanes()));
+        }
+
+        // Magnitude (length) of the vector
+        float magnitude() const {
+            return std::sqrt(dot(*this));
+        }
+
+        // Unit vector, exact to rounding
+        Vec4 normalize() const {
+            const detail::Lanes v = lanes();
+            return Vec4(detail::div(v, detail::sqrt(detail::dot(v, v))));
+        }
+
+        // Unit vector from the reciprocal square root estimate
+        Vec4 normalizeFast() const {
+            const detail::Lanes v = lanes();
+            return Vec4(detail::mul(v, detail::rsqrtFast(detail::dot(v, v))));
+        }
+
+        // Linear interpolation
+        static Vec4 lerp(const Vec4& start, const Vec4& end, float t) {
+            return start + (end - start) * t;
+        }
+
+      private:
+        explicit Vec4(detail::Lanes value) {
+            detail::store(&x, value);
+        }
+
+        detail::Lanes lanes() const {
+            return detail::load(&x);
+        }
+    };
+}; // namespace omelette::utils
+
+#endif // OMELETTE_UTILS_VEC4_HPP
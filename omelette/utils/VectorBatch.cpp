@@ -0,0 +1,149 @@
+#include "VectorBatch.hpp"
+
+#include <cmath>
+
+#ifdef __SSE2__
+    #define OMELETTE_VECTORBATCH_SSE 1
+    #include <emmintrin.h>
+#endif
+
+namespace omelette::utils::VectorBatch {
+    // The kernels treat a Vec3 array as packed floats
+    static_assert(sizeof(Vec3) == 3 * sizeof(float), "Vec3 must be packed");
+
+    namespace {
+#ifdef OMELETTE_VECTORBATCH_SSE
+        // Four packed vectors as x, y and z lanes
+        struct Lanes3 {
+            __m128 x, y, z;
+        };
+
+        /* Load Packed
+        - Loads vectors [0, 4) of a packed array. Registers a, b and c hold
+          x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3. */
+        Lanes3 loadPacked(const float* from) {
+            const __m128 a = _mm_loadu_ps(from);
+            const __m128 b = _mm_loadu_ps(from + 4);
+            const __m128 c = _mm_loadu_ps(from + 8);
+            const __m128 xy = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+            const __m128 yz = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+            return {
+                _mm_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0)),
+                _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)),
+                _mm_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1))
+            };
+        }
+
+        /* Store Packed
+        - Interleaves x, y and z lanes back into four packed vectors. */
+        void storePacked(float* to, const Lanes3& v) {
+            const __m128 p = _mm_shuffle_ps(v.x, v.y, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 q = _mm_shuffle_ps(v.y, v.z, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 s = _mm_shuffle_ps(v.z, v.x, _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_ps(to, _mm_shuffle_ps(p, s, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(
+                to + 4,
+                _mm_shuffle_ps(q, p, _MM_SHUFFLE(3, 1, 2, 0))
+            );
+            _mm_storeu_ps(
+                to + 8,
+                _mm_shuffle_ps(s, q, _MM_SHUFFLE(3, 1, 3, 1))
+            );
+        }
+
+        /* Squared Length
+        - Returns x * x + y * y + z * z per lane, summed in the same order
+          as Vec3::magnitude. */
+        __m128 squaredLength(const Lanes3& v) {
+            return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(v.x, v.x), _mm_mul_ps(v.y, v.y)),
+                _mm_mul_ps(v.z, v.z)
+            );
+        }
+#endif
+    } // namespace
+
+    /* Normalize
+    - Normalizes vectors with an exact square root and division, so every
+      result matches Vec3::normalize bit for bit.
+    - Parameters:
+        - input: The vectors to normalize.
+        - output: Receives the unit vectors.
+        - count: The number of vectors. */
+    void normalize(const Vec3* input, Vec3* output, size_t count) {
+        size_t i = 0;
+#ifdef OMELETTE_VECTORBATCH_SSE
+        for (; i + 4 <= count; i += 4) {
+            Lanes3 v = loadPacked(&input[i].x);
+            const __m128 length = _mm_sqrt_ps(squaredLength(v));
+            v.x = _mm_div_ps(v.x, length);
+            v.y = _mm_div_ps(v.y, length);
+            v.z = _mm_div_ps(v.z, length);
+            storePacked(&output[i].x, v);
+        }
+#endif
+        for (; i < count; i++) {
+            output[i] = input[i].normalize();
+        }
+    }
+
+    /* Normalize Fast
+    - Normalizes vectors with the reciprocal square root estimate refined
+      by one Newton-Raphson step, trading exactness for a multiply instead
+      of a square root and divide.
+    - Parameters:
+        - input: The vectors to normalize.
+        - output: Receives the unit vectors.
+        - count: The number of vectors. */
+    void normalizeFast(const Vec3* input, Vec3* output, size_t count) {
+        size_t i = 0;
+#ifdef OMELETTE_VECTORBATCH_SSE
+        for (; i + 4 <= count; i += 4) {
+            Lanes3 v = loadPacked(&input[i].x);
+            const __m128 inverse = detail::rsqrtFast(squaredLength(v));
+            v.x = _mm_mul_ps(v.x, inverse);
+            v.y = _mm_mul_ps(v.y, inverse);
+            v.z = _mm_mul_ps(v.z, inverse);
+            storePacked(&output[i].x, v);
+        }
+        for (; i < count; i++) {
+            output[i] = Vec3A(input[i]).normalizeFast().toVec3();
+        }
+#else
+        for (; i < count; i++) {
+            output[i] = input[i].normalize();
+        }
+#endif
+    }
+
+    /* Normalize Fast
+    - Normalizes aligned vectors, one register each.
+    - Parameters:
+        - input: The vectors to normalize.
+        - output: Receives the unit vectors.
+        - count: The number of vectors. */
+    void normalizeFast(const Vec3A* input, Vec3A* output, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            output[i] = input[i].normalizeFast();
+        }
+    }
+
+    /* Magnitude
+    - Computes the length of each vector.
+    - Parameters:
+        - input: The vectors.
+        - output: Receives the lengths.
+        - count: The number of vectors. */
+    void magnitude(const Vec3* input, float* output, size_t count) {
+        size_t i = 0;
+#ifdef OMELETTE_VECTORBATCH_SSE
+        for (; i + 4 <= count; i += 4) {
+            const Lanes3 v = loadPacked(&input[i].x);
+            _mm_storeu_ps(output + i, _mm_sqrt_ps(squaredLength(v)));
+        }
+#endif
+        for (; i < count; i++) {
+            output[i] = input[i].magnitude();
+        }
+    }
+}; // namespace omelette::utils::VectorBatch
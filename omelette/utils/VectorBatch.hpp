@@ -0,0 +1,27 @@
+#ifndef OMELETTE_UTILS_VECTORBATCH_HPP
+#define OMELETTE_UTILS_VECTORBATCH_HPP
+
+#include <cstddef>
+
+#include "Vec3.hpp"
+#include "Vec4.hpp"
+
+// Batched vector math over arrays. The Vec3 kernels read the packed
+// 12-byte layout four vectors at a time, deinterleaved into x, y and z
+// lanes, so one SSE instruction works on four vectors. Input and output
+// may be the same array.
+namespace omelette::utils::VectorBatch {
+    // Normalize count vectors, bit-identical to Vec3::normalize
+    void normalize(const Vec3* input, Vec3* output, size_t count);
+
+    // Normalize count vectors with the reciprocal square root estimate
+    // and one Newton-Raphson step, accurate to a few units in the last
+    // place
+    void normalizeFast(const Vec3* input, Vec3* output, size_t count);
+    void normalizeFast(const Vec3A* input, Vec3A* output, size_t count);
+
+    // Lengths of count vectors
+    void magnitude(const Vec3* input, float* output, size_t count);
+}; // namespace omelette::utils::VectorBatch
+
+#endif // OMELETTE_UTILS_VECTORBATCH_HPP
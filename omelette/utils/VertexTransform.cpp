@@ -0,0 +1,358 @@
+#include "VertexTransform.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define OMELETTE_VERTEXTRANSFORM_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace omelette::utils::VertexTransform {
+    // The kernels treat a Vec3 array as packed floats
+    static_assert(sizeof(Vec3) == 3 * sizeof(float), "Vec3 must be packed");
+
+    namespace {
+        /* Transform Scalar
+        - Transforms vertices [begin, count) one at a time. */
+        void transformScalar(
+            const glm::mat4& m,
+            const Vec3* input,
+            Vec3* output,
+            size_t begin,
+            size_t count
+        ) {
+            for (size_t i = begin; i < count; i++) {
+                const float x = input[i].x;
+                const float y = input[i].y;
+                const float z = input[i].z;
+                output[i] = Vec3(
+                    ((m[0][0] * x + m[1][0] * y) + m[2][0] * z) + m[3][0],
+                    ((m[0][1] * x + m[1][1] * y) + m[2][1] * z) + m[3][1],
+                    ((m[0][2] * x + m[1][2] * y) + m[2][2] * z) + m[3][2]
+                );
+            }
+        }
+
+#ifdef OMELETTE_VERTEXTRANSFORM_X86
+        /* Transform SSE2
+        - Transforms four vertices at a time. Registers a, b and c hold
+          x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3. */
+        __attribute__((target("sse2"))) void transformSSE2(
+            const glm::mat4& m,
+            const Vec3* input,
+            Vec3* output,
+            size_t count
+        ) {
+            __m128 column[4][3];
+            for (int c = 0; c < 4; c++) {
+                for (int r = 0; r < 3; r++) {
+                    column[c][r] = _mm_set1_ps(m[c][r]);
+                }
+            }
+
+            const float* in = &input[0].x;
+            float* out = &output[0].x;
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128 a = _mm_loadu_ps(in + 3 * i);
+                const __m128 b = _mm_loadu_ps(in + 3 * i + 4);
+                const __m128 c = _mm_loadu_ps(in + 3 * i + 8);
+
+                // Deinterleave into x0 x1 x2 x3, y0 y1 y2 y3, z0 z1 z2 z3
+                const __m128 xy =
+                    _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+                const __m128 yz =
+                    _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+                const __m128 x =
+                    _mm_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+                const __m128 y =
+                    _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+                const __m128 z =
+                    _mm_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+                __m128 rows[3];
+                for (int r = 0; r < 3; r++) {
+                    rows[r] = _mm_add_ps(
+                        _mm_add_ps(
+                            _mm_add_ps(
+                                _mm_mul_ps(column[0][r], x),
+                                _mm_mul_ps(column[1][r], y)
+                            ),
+                            _mm_mul_ps(column[2][r], z)
+                        ),
+                        column[3][r]
+                    );
+                }
+
+                // Interleave back into the packed layout
+                const __m128 p = _mm_shuffle_ps(
+                    rows[0],
+                    rows[1],
+                    _MM_SHUFFLE(2, 0, 2, 0)
+                );
+                const __m128 q = _mm_shuffle_ps(
+                    rows[1],
+                    rows[2],
+                    _MM_SHUFFLE(3, 1, 3, 1)
+                );
+                const __m128 s = _mm_shuffle_ps(
+                    rows[2],
+                    rows[0],
+                    _MM_SHUFFLE(3, 1, 2, 0)
+                );
+                _mm_storeu_ps(
+                    out + 3 * i,
+                    _mm_shuffle_ps(p, s, _MM_SHUFFLE(2, 0, 2, 0))
+                );
+                _mm_storeu_ps(
+                    out + 3 * i + 4,
+                    _mm_shuffle_ps(q, p, _MM_SHUFFLE(3, 1, 2, 0))
+                );
+                _mm_storeu_ps(
+                    out + 3 * i + 8,
+                    _mm_shuffle_ps(s, q, _MM_SHUFFLE(3, 1, 3, 1))
+                );
+            }
+            transformScalar(m, input, output, i, count);
+        }
+
+        /* Load Halves
+        - Loads floats [0, 4) into the low half and [12, 16) into the high
+          half, which is where the second group of four vertices starts. */
+        __attribute__((target("avx"))) __m256 loadHalves(const float* from) {
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(from)),
+                _mm_loadu_ps(from + 12),
+                1
+            );
+        }
+
+        /* Store Halves
+        - Stores the halves of a register where loadHalves read them. */
+        __attribute__((target("avx"))) void storeHalves(
+            float* to,
+            __m256 value
+        ) {
+            _mm_storeu_ps(to, _mm256_castps256_ps128(value));
+            _mm_storeu_ps(to + 12, _mm256_extractf128_ps(value, 1));
+        }
+
+        /* Transform AVX
+        - Transforms eight vertices at a time. The low and high halves of
+          each register hold the same layout as the SSE2 kernel for
+          vertices 0-3 and 4-7, and AVX shuffles act on each half. */
+        __attribute__((target("avx"))) void transformAVX(
+            const glm::mat4& m,
+            const Vec3* input,
+            Vec3* output,
+            size_t count
+        ) {
+            __m256 column[4][3];
+            for (int c = 0; c < 4; c++) {
+                for (int r = 0; r < 3; r++) {
+                    column[c][r] = _mm256_set1_ps(m[c][r]);
+                }
+            }
+
+            const float* in = &input[0].x;
+            float* out = &output[0].x;
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m256 a = loadHalves(in + 3 * i);
+                const __m256 b = loadHalves(in + 3 * i + 4);
+                const __m256 c = loadHalves(in + 3 * i + 8);
+
+                const __m256 xy =
+                    _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+                const __m256 yz =
+                    _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+                const __m256 x =
+                    _mm256_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+                const __m256 y =
+                    _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+                const __m256 z =
+                    _mm256_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+                __m256 rows[3];
+                for (int r = 0; r < 3; r++) {
+                    rows[r] = _mm256_add_ps(
+                        _mm256_add_ps(
+                            _mm256_add_ps(
+                                _mm256_mul_ps(column[0][r], x),
+                                _mm256_mul_ps(column[1][r], y)
+                            ),
+                            _mm256_mul_ps(column[2][r], z)
+                        ),
+                        column[3][r]
+                    );
+                }
+
+                const __m256 p = _mm256_shuffle_ps(
+                    rows[0],
+                    rows[1],
+                    _MM_SHUFFLE(2, 0, 2, 0)
+                );
+                const __m256 q = _mm256_shuffle_ps(
+                    rows[1],
+                    rows[2],
+                    _MM_SHUFFLE(3, 1, 3, 1)
+                );
+                const __m256 s = _mm256_shuffle_ps(
+                    rows[2],
+                    rows[0],
+                    _MM_SHUFFLE(3, 1, 2, 0)
+                );
+                storeHalves(
+                    out + 3 * i,
+                    _mm256_shuffle_ps(p, s, _MM_SHUFFLE(2, 0, 2, 0))
+                );
+                storeHalves(
+                    out + 3 * i + 4,
+                    _mm256_shuffle_ps(q, p, _MM_SHUFFLE(3, 1, 2, 0))
+                );
+                storeHalves(
+                    out + 3 * i + 8,
+                    _mm256_shuffle_ps(s, q, _MM_SHUFFLE(3, 1, 3, 1))
+                );
+            }
+            transformScalar(m, input, output, i, count);
+        }
+#endif
+    } // namespace
+
+    /* Transform
+    - Transforms vertices with the best supported kernel.
+    - Parameters:
+        - matrix: The affine transform to apply.
+        - input: The vertices to transform.
+        - output: Receives the transformed vertices; may equal input.
+        - count: The number of vertices. */
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count
+    ) {
+        transform(matrix, input, output, count, getSimdLevel());
+    }
+
+    /* Transform
+    - Transforms vertices with a specific kernel. Requesting a level the
+      build does not support falls back to the scalar kernel.
+    - Parameters:
+        - matrix: The affine transform to apply.
+        - input: The vertices to transform.
+        - output: Receives the transformed vertices; may equal input.
+        - count: The number of vertices.
+        - level: The kernel to use. */
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count,
+        SimdLevel level
+    ) {
+        if (count == 0) {
+            return;
+        }
+
+        switch (level) {
+#ifdef OMELETTE_VERTEXTRANSFORM_X86
+            case SimdLevel::AVX:
+                transformAVX(matrix, input, output, count);
+                break;
+            case SimdLevel::SSE2:
+                transformSSE2(matrix, input, output, count);
+                break;
+#endif
+            default:
+                transformScalar(matrix, input, output, 0, count);
+                break;
+        }
+    }
+
+    /* Transform
+    - Transforms vertices in parallel chunks. Small arrays run inline.
+    - Parameters:
+        - matrix: The affine transform to apply.
+        - input: The vertices to transform.
+        - output: Receives the transformed vertices; may equal input.
+        - count: The number of vertices.
+        - threadPool: The pool to run chunks on.
+        - grainSize: Minimum vertices per chunk. */
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count,
+        ThreadPool& threadPool,
+        size_t grainSize
+    ) {
+        threadPool.parallelFor(count, grainSize, [&](size_t begin, size_t end) {
+            transform(matrix, input + begin, output + begin, end - begin);
+        });
+    }
+
+    /* Transform Instances
+    - Transforms one mesh once per instance matrix.
+    - Parameters:
+        - matrices: One transform per instance.
+        - instanceCount: The number of instances.
+        - input: The mesh vertices.
+        - vertexCount: The number of mesh vertices.
+        - output: Receives instanceCount * vertexCount vertices. */
+    void transformInstances(
+        const glm::mat4* matrices,
+        size_t instanceCount,
+        const Vec3* input,
+        size_t vertexCount,
+        Vec3* output
+    ) {
+        for (size_t instance = 0; instance < instanceCount; instance++) {
+            transform(
+                matrices[instance],
+                input,
+                output + instance * vertexCount,
+                vertexCount
+            );
+        }
+    }
+
+    /* Transform Instances
+    - Transforms one mesh once per instance matrix in parallel. Chunks
+      cover whole instances, grouping small meshes so that each chunk has
+      about grainSize vertices.
+    - Parameters:
+        - matrices: One transform per instance.
+        - instanceCount: The number of instances.
+        - input: The mesh vertices.
+        - vertexCount: The number of mesh vertices.
+        - output: Receives instanceCount * vertexCount vertices.
+        - threadPool: The pool to run chunks on.
+        - grainSize: Minimum vertices per chunk. */
+    void transformInstances(
+        const glm::mat4* matrices,
+        size_t instanceCount,
+        const Vec3* input,
+        size_t vertexCount,
+        Vec3* output,
+        ThreadPool& threadPool,
+        size_t grainSize
+    ) {
+        const size_t instancesPerChunk =
+            std::max<size_t>(1, grainSize / std::max<size_t>(1, vertexCount));
+        threadPool.parallelFor(
+            instanceCount,
+            instancesPerChunk,
+            [&](size_t begin, size_t end) {
+                transformInstances(
+                    matrices + begin,
+                    end - begin,
+                    input,
+                    vertexCount,
+                    output + begin * vertexCount
+                );
+            }
+        );
+    }
+}; // namespace omelette::utils::VertexTransform
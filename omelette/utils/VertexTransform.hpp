@@ -0,0 +1,69 @@
+#ifndef OMELETTE_UTILS_VERTEXTRANSFORM_HPP
+#define OMELETTE_UTILS_VERTEXTRANSFORM_HPP
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+#include "Simd.hpp"
+#include "ThreadPool.hpp"
+#include "Vec3.hpp"
+
+// Batched affine transform of Vec3 arrays: output = M * (input, 1).
+//
+// The kernels read the packed 12-byte Vec3 layout directly. SSE2 loads four
+// vertices as three registers and deinterleaves them into x, y and z lanes
+// with shuffles; AVX does the same for eight vertices, one group of four
+// per 128-bit half. Rows are computed as ((m0 * x + m1 * y) + m2 * z) + m3
+// in every kernel, without fused multiply-add, so all kernels give
+// bit-identical results. Input and output may be the same array.
+namespace omelette::utils::VertexTransform {
+    // Transform count vertices with the best supported kernel
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count
+    );
+
+    // Transform count vertices with a specific kernel
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count,
+        SimdLevel level
+    );
+
+    // Transform count vertices in parallel chunks of at least grainSize
+    void transform(
+        const glm::mat4& matrix,
+        const Vec3* input,
+        Vec3* output,
+        size_t count,
+        ThreadPool& threadPool,
+        size_t grainSize = 16384
+    );
+
+    // Transform one mesh by a matrix per instance. Instance i writes
+    // output[i * vertexCount .. (i + 1) * vertexCount)
+    void transformInstances(
+        const glm::mat4* matrices,
+        size_t instanceCount,
+        const Vec3* input,
+        size_t vertexCount,
+        Vec3* output
+    );
+
+    // Transform instances in parallel, grainSize vertices per chunk
+    void transformInstances(
+        const glm::mat4* matrices,
+        size_t instanceCount,
+        const Vec3* input,
+        size_t vertexCount,
+        Vec3* output,
+        ThreadPool& threadPool,
+        size_t grainSize = 16384
+    );
+}; // namespace omelette::utils::VertexTransform
+
+#endif // OMELETTE_UTILS_VERTEXTRANSFORM_HPP
@@ -6,12 +6,15 @@
 #include <ecs/Components/RigidBodyComponent.hpp>
 #include <ecs/ECS.hpp>
 #include <ecs/Entity.hpp>
+#include <ecs/Systems/IntegrationSystem.hpp>
+#include <ecs/Systems/MeshTransformSystem.hpp>
+#include <ecs/World.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
-#include <thread>
-#include <utils/Shapes.hpp>
+#include <utils/MeshCache.hpp>
+#include <utils/Profiler.hpp>
 #include <utils/Vec3.hpp>
 
 // Shader sources
@@ -38,9 +41,15 @@ const char* fragmentShaderSource = R"(
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
-// Target frame rate
-const float FRAME_RATE = 10.0f;
-const std::chrono::milliseconds FRAME_DURATION(100); // 100ms = 10 FPS
+// Physics rate; rendering runs as fast as the display allows
+const float PHYSICS_RATE = 60.0f;
+const unsigned int MAX_SUBSTEPS = 8;
+
+#ifdef OMELETTE_PROFILE
+// Where the profile of the first frames is written on exit
+const char* TRACE_PATH = "omelette-trace.json";
+const uint64_t TRACE_FRAMES = 600;
+#endif
 
 // Function declarations
 GLFWwindow* initializeGL();
@@ -56,14 +65,16 @@ int main() {
     // Create and compile shaders
     unsigned int shaderProgram = createShaderProgram();
 
-    // Create ECS instance and entity
-    omelette::ecs::ECS ecs;
-    auto entity = std::make_unique<omelette::ecs::Entity>();
-    auto entityPtr = entity.get();
+    // Create the world, its ECS and an entity
+    omelette::ecs::World world({1.0f / PHYSICS_RATE, MAX_SUBSTEPS});
+    omelette::ecs::ECS& ecs = world.getECS();
+    auto entity = ecs.createEntity();
 
-    // Create cube shape
-    auto [vertices, indices] =
-        omelette::utils::Shapes::createCube(1.0f, 1.0f, 1.0f);
+    // Create cube shape, shared by every entity that uses it
+    omelette::utils::MeshCache meshCache;
+    omelette::utils::MeshHandle cube = meshCache.cube(1.0f, 1.0f, 1.0f);
+    const auto& vertices = cube->vertices;
+    const auto& indices = cube->indices;
 
     // Create OpenGL buffers
     unsigned int VBO, VAO, EBO;
@@ -79,17 +90,21 @@ int main() {
         GL_ARRAY_BUFFER,
         vertices.size() * sizeof(omelette::utils::Vec3),
         vertices.data(),
-        GL_DYNAMIC_DRAW
+        GL_STATIC_DRAW
     );
 
     // Element buffer
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(
         GL_ELEMENT_ARRAY_BUFFER,
-        indices.size() * sizeof(uintptr_t),
+        indices.getByteSize(),
         indices.data(),
         GL_STATIC_DRAW
     );
+    const GLenum indexType =
+        indices.getType() == omelette::utils::IndexType::UInt16
+        ? GL_UNSIGNED_SHORT
+        : GL_UNSIGNED_INT;
 
     // Set vertex attributes
     glVertexAttribPointer(
@@ -104,26 +119,31 @@ int main() {
 
     // Create components
     auto meshComponent =
-        std::make_unique<omelette::ecs::components::MeshComponent>(
-            vertices,
-            indices
-        );
-    auto meshComponentPtr = meshComponent.get();
+        std::make_unique<omelette::ecs::components::MeshComponent>(cube);
 
     auto rigidBody =
         std::make_unique<omelette::ecs::components::RigidBodyComponent>(
             omelette::utils::Vec3(0, 0, 0), // position
             omelette::utils::Vec3(0, 0, 0), // velocity
             omelette::utils::Vec3(0, 0, 0), // acceleration
-            1.0f, // mass
-            meshComponentPtr // mesh component
+            1.0f // mass
         );
-    auto rbPtr = rigidBody.get();
 
     // Add components to ECS
-    ecs.addEntity(std::move(entity));
-    ecs.addComponentToEntity(*entityPtr, std::move(meshComponent));
-    ecs.addComponentToEntity(*entityPtr, std::move(rigidBody));
+    ecs.addComponentToEntity(entity, std::move(meshComponent));
+    ecs.addComponentToEntity(entity, std::move(rigidBody));
+
+    // Components are stored by value in the ECS, so look them up once the
+    // entity's component set is final
+    auto meshComponentPtr =
+        ecs.getComponent<omelette::ecs::components::MeshComponent>(entity);
+    auto rbPtr =
+        ecs.getComponent<omelette::ecs::components::RigidBodyComponent>(entity);
+
+    // Register physics systems
+    omelette::ecs::Scheduler& scheduler = world.getScheduler();
+    scheduler.addSystem<omelette::ecs::systems::IntegrationSystem>();
+    scheduler.addSystem<omelette::ecs::systems::MeshTransformSystem>();
 
     // Set up camera
     glm::mat4 view = glm::lookAt(
@@ -150,90 +170,87 @@ int main() {
     // Set polygon mode to render wireframe (for debugging)
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-    // Simulation/render loop
-    float deltaTime = 1.0f / FRAME_RATE;
+#ifdef OMELETTE_PROFILE
+    omelette::utils::Profiler::get().startCapture();
+#endif
+
+    // Simulation/render loop. Physics runs at a fixed rate however fast
+    // frames are drawn; each frame shows the state between the last two
+    // physics steps that matches the current time.
     auto lastFrameTime = std::chrono::steady_clock::now();
 
     while (!glfwWindowShouldClose(window)) {
         auto currentFrameTime = std::chrono::steady_clock::now();
-        auto frameTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            currentFrameTime - lastFrameTime
+        std::chrono::duration<double> frameTime =
+            currentFrameTime - lastFrameTime;
+        lastFrameTime = currentFrameTime;
+
+        // Process input
+        processInput(window);
+
+        // Update physics
+        world.step(frameTime.count());
+
+        // Clear buffers
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        // Use shader program
+        glUseProgram(shaderProgram);
+
+        // Set uniforms
+        glUniformMatrix4fv(
+            glGetUniformLocation(shaderProgram, "view"),
+            1,
+            GL_FALSE,
+            glm::value_ptr(view)
+        );
+        glUniformMatrix4fv(
+            glGetUniformLocation(shaderProgram, "projection"),
+            1,
+            GL_FALSE,
+            glm::value_ptr(projection)
         );
 
-        if (frameTime >= FRAME_DURATION) {
-            lastFrameTime = currentFrameTime;
-
-            // Process input
-            processInput(window);
-
-            // Clear buffers
-            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-            // Use shader program
-            glUseProgram(shaderProgram);
-
-            // Update physics
-            rbPtr->update(deltaTime);
-
-            // Update vertex data
-            const auto& updatedVertices = meshComponentPtr->getVertices();
-            glBindBuffer(GL_ARRAY_BUFFER, VBO);
-            glBufferSubData(
-                GL_ARRAY_BUFFER,
-                0,
-                updatedVertices.size() * sizeof(omelette::utils::Vec3),
-                updatedVertices.data()
-            );
-
-            // Set uniforms
-            glUniformMatrix4fv(
-                glGetUniformLocation(shaderProgram, "view"),
-                1,
-                GL_FALSE,
-                glm::value_ptr(view)
-            );
-            glUniformMatrix4fv(
-                glGetUniformLocation(shaderProgram, "projection"),
-                1,
-                GL_FALSE,
-                glm::value_ptr(projection)
-            );
-
-            // Create and set model matrix
-            glm::mat4 model = glm::mat4(1.0f);
-            model = glm::translate(
-                model,
-                glm::vec3(
-                    rbPtr->position.x,
-                    rbPtr->position.y,
-                    rbPtr->position.z
-                )
-            );
-            glUniformMatrix4fv(
-                glGetUniformLocation(shaderProgram, "model"),
-                1,
-                GL_FALSE,
-                glm::value_ptr(model)
-            );
-
-            // Draw cube
-            glBindVertexArray(VAO);
-            glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
-
-            // Swap buffers and poll events
-            glfwSwapBuffers(window);
-            glfwPollEvents();
-
-            // Print position for debugging
-            std::cout << "Position: (" << rbPtr->position.x << ", "
-                      << rbPtr->position.y << ", " << rbPtr->position.z
-                      << ")\n";
-        } else {
-            // Sleep to prevent CPU from running at 100%
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        // The VBO holds the rest pose; the GPU applies the world
+        // transform, so the CPU never transforms the vertices. The mesh
+        // transform is moved back to the interpolated position.
+        const omelette::utils::Vec3 offset =
+            rbPtr->interpolatedPosition(world.getAlpha()) - rbPtr->position;
+        const glm::mat4 model = glm::translate(
+                                    glm::mat4(1.0f),
+                                    glm::vec3(offset.x, offset.y, offset.z)
+                                )
+            * meshComponentPtr->getTransform();
+        glUniformMatrix4fv(
+            glGetUniformLocation(shaderProgram, "model"),
+            1,
+            GL_FALSE,
+            glm::value_ptr(model)
+        );
+
+        // Draw cube
+        glBindVertexArray(VAO);
+        glDrawElements(GL_TRIANGLES, indices.size(), indexType, 0);
+
+        // Swap buffers and poll events
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+
+        OMELETTE_PROFILE_FRAME();
+#ifdef OMELETTE_PROFILE
+        if (omelette::utils::Profiler::get().getFrameCount() == TRACE_FRAMES) {
+            omelette::utils::Profiler::get().stopCapture();
         }
+#endif
+    }
+
+#ifdef OMELETTE_PROFILE
+    // Open in chrome://tracing or ui.perfetto.dev
+    if (omelette::utils::Profiler::get().saveChromeTrace(TRACE_PATH)) {
+        std::cout << "Wrote profile to " << TRACE_PATH << std::endl;
     }
+#endif
 
     // Cleanup
     glDeleteVertexArrays(1, &VAO);
@@ -267,6 +284,9 @@ GLFWwindow* initializeGL() {
     }
     glfwMakeContextCurrent(window);
 
+    // Present at the display's refresh rate
+    glfwSwapInterval(1);
+
     // Initialize GLEW
     if (glewInit() != GLEW_OK) {
         std::cout << "Failed to initialize GLEW" << std::endl;
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <cstddef>
+#include <ecs/Entity.hpp>
+#include <memory>
+#include <physics/Broadphase.hpp>
+#include <random>
+#include <utils/AABB.hpp>
+#include <vector>
+
+#include "Test.hpp"
+
+// Both broadphases against a brute-force O(n^2) pair search over the same
+// fat boxes, through create, move and destroy
+namespace {
+    using omelette::ecs::Entity;
+    using omelette::physics::Broadphase;
+    using omelette::physics::BroadphasePair;
+    using omelette::physics::BroadphaseType;
+    using omelette::physics::ProxyId;
+    using omelette::utils::AABB;
+    using omelette::utils::Vec3;
+
+    struct Body {
+        Entity entity;
+        ProxyId proxy;
+        AABB aabb;
+    };
+
+    // A broadphase and the bodies registered with it
+    struct Scene {
+        std::unique_ptr<Broadphase> broadphase;
+        std::vector<Body> bodies;
+    };
+
+    // Random box of size 0.2 to 2 in a 20 m cube
+    AABB randomBox(std::mt19937& random) {
+        std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> size(0.2f, 2.0f);
+        const Vec3 min(position(random), position(random), position(random));
+        return AABB(min, min + Vec3(size(random), size(random), size(random)));
+    }
+
+    // Every pair of bodies whose fat boxes overlap, sorted
+    std::vector<BroadphasePair> bruteForcePairs(const Scene& scene) {
+        std::vector<BroadphasePair> pairs;
+        const auto& bodies = scene.bodies;
+        for (size_t i = 0; i < bodies.size(); i++) {
+            for (size_t j = i + 1; j < bodies.size(); j++) {
+                const AABB& a = scene.broadphase->getFatAABB(bodies[i].proxy);
+                const AABB& b = scene.broadphase->getFatAABB(bodies[j].proxy);
+                if (a.overlaps(b)) {
+                    const Entity first = bodies[i].entity;
+                    const Entity second = bodies[j].entity;
+                    pairs.push_back(
+                        {std::min(first, second), std::max(first, second)}
+                    );
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    // Check a broadphase's pairs against the brute-force search, and that
+    // every fat box still contains its tight box. Returns the pairs.
+    std::vector<BroadphasePair> checkPairs(Scene& scene) {
+        std::vector<BroadphasePair> pairs;
+        scene.broadphase->computePairs(pairs);
+        CHECK(pairs == bruteForcePairs(scene));
+        CHECK(scene.broadphase->getProxyCount() == scene.bodies.size());
+        for (const auto& body : scene.bodies) {
+            const AABB& fat = scene.broadphase->getFatAABB(body.proxy);
+            CHECK(fat.contains(body.aabb));
+        }
+        return pairs;
+    }
+
+    // Run a fixed random scene through a broadphase, checking it after
+    // every phase. Returns the pairs of every phase.
+    std::vector<std::vector<BroadphasePair>>
+    checkBroadphase(BroadphaseType type) {
+        std::vector<std::vector<BroadphasePair>> phases;
+        std::mt19937 random(7);
+        Scene scene{omelette::physics::createBroadphase(type), {}};
+        uint32_t nextIndex = 0;
+        auto create = [&](size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                const Entity entity(nextIndex++, 0);
+                const AABB aabb = randomBox(random);
+                scene.bodies.push_back(
+                    {entity, scene.broadphase->createProxy(aabb, entity), aabb}
+                );
+            }
+        };
+
+        create(300);
+        phases.push_back(checkPairs(scene));
+
+        // Small jitter mostly stays inside the fat boxes; every tenth body
+        // jumps somewhere else
+        std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+        for (int step = 0; step < 5; step++) {
+            for (size_t i = 0; i < scene.bodies.size(); i++) {
+                auto& body = scene.bodies[i];
+                const Vec3 offset(
+                    jitter(random),
+                    jitter(random),
+                    jitter(random)
+                );
+                const AABB moved = i % 10 == size_t(step)
+                    ? randomBox(random)
+                    : body.aabb.translated(offset);
+                scene.broadphase->moveProxy(body.proxy, moved, offset);
+                body.aabb = moved;
+            }
+            phases.push_back(checkPairs(scene));
+        }
+
+        // Destroy a random third, then refill with new proxies
+        std::shuffle(scene.bodies.begin(), scene.bodies.end(), random);
+        for (size_t i = 0; i < 100; i++) {
+            scene.broadphase->destroyProxy(scene.bodies.back().proxy);
+            scene.bodies.pop_back();
+        }
+        phases.push_back(checkPairs(scene));
+        create(50);
+        phases.push_back(checkPairs(scene));
+        return phases;
+    }
+} // namespace
+
+OMELETTE_TEST(broadphase, dynamic_tree_matches_brute_force) {
+    checkBroadphase(BroadphaseType::DynamicTree);
+}
+
+OMELETTE_TEST(broadphase, sweep_and_prune_matches_brute_force) {
+    checkBroadphase(BroadphaseType::SweepAndPrune);
+}
+
+OMELETTE_TEST(broadphase, implementations_agree) {
+    const auto tree = checkBroadphase(BroadphaseType::DynamicTree);
+    const auto sweep = checkBroadphase(BroadphaseType::SweepAndPrune);
+    CHECK(tree == sweep);
+    // The scene must actually produce pairs for the checks to mean much
+    CHECK(!tree.front().empty());
+}
@@ -0,0 +1,87 @@
+#include <ecs/CommandBuffer.hpp>
+#include <ecs/Components/ColliderComponent.hpp>
+#include <ecs/Components/RigidBodyComponent.hpp>
+#include <ecs/ECS.hpp>
+#include <physics/Shape.hpp>
+
+#include "Test.hpp"
+
+// Deferred structural changes, applied in recording order
+namespace {
+    using omelette::ecs::ECS;
+    using omelette::ecs::Entity;
+    using omelette::ecs::components::ColliderComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+    using omelette::utils::Vec3;
+
+    // Body whose x position identifies it
+    RigidBodyComponent bodyAt(float x) {
+        return RigidBodyComponent(Vec3(x, 0.0f, 0.0f), Vec3(), Vec3(), 1.0f);
+    }
+
+    ColliderComponent unitSphere() {
+        return ColliderComponent(omelette::physics::Shape::sphere(1.0f));
+    }
+} // namespace
+
+OMELETTE_TEST(command_buffer, applies_in_recording_order) {
+    ECS ecs;
+    const Entity added = ecs.createEntity();
+    const Entity removed = ecs.createEntity();
+    ecs.addComponentToEntity(removed, unitSphere());
+
+    omelette::ecs::CommandBuffer commands;
+    // Add then remove: the component ends up gone
+    commands.addComponentToEntity(added, unitSphere());
+    commands.removeComponentFromEntity<ColliderComponent>(added);
+    // Remove then add: the component ends up present
+    commands.removeComponentFromEntity<ColliderComponent>(removed);
+    commands.addComponentToEntity(removed, bodyAt(7.0f));
+    commands.addComponentToEntity(removed, unitSphere());
+    // A later add replaces an earlier one
+    commands.addComponentToEntity(added, bodyAt(1.0f));
+    commands.addComponentToEntity(added, bodyAt(2.0f));
+    CHECK(commands.size() == 7);
+
+    // Nothing changes until the buffer is applied
+    CHECK(!ecs.hasComponent<RigidBodyComponent>(added));
+    commands.apply(ecs);
+    CHECK(commands.size() == 0);
+
+    CHECK(!ecs.hasComponent<ColliderComponent>(added));
+    CHECK(ecs.getComponent<RigidBodyComponent>(added)->position.x == 2.0f);
+    CHECK(ecs.hasComponent<ColliderComponent>(removed));
+    CHECK(ecs.getComponent<RigidBodyComponent>(removed)->position.x == 7.0f);
+}
+
+OMELETTE_TEST(command_buffer, skips_commands_on_destroyed_entities) {
+    ECS ecs;
+    const Entity entity = ecs.createEntity();
+
+    omelette::ecs::CommandBuffer commands;
+    commands.destroyEntity(entity);
+    commands.addComponentToEntity(entity, bodyAt(1.0f));
+    commands.removeComponentFromEntity<RigidBodyComponent>(entity);
+    commands.destroyEntity(entity);
+    commands.createEntities(3, bodyAt(5.0f));
+    commands.apply(ecs);
+
+    CHECK(!ecs.isAlive(entity));
+    CHECK(ecs.getEntities().size() == 3);
+    CHECK(ecs.view<RigidBodyComponent>().size() == 3);
+
+    // Cleared commands never run
+    commands.destroyEntity(ecs.getEntities()[0]);
+    commands.clear();
+    commands.apply(ecs);
+    CHECK(ecs.getEntities().size() == 3);
+}
+
+OMELETTE_TEST(command_buffer, ecs_applies_its_buffer) {
+    ECS ecs;
+    const Entity entity = ecs.createEntity();
+    ecs.getCommandBuffer().addComponentToEntity(entity, bodyAt(3.0f));
+    CHECK(!ecs.hasComponent<RigidBodyComponent>(entity));
+    ecs.applyCommands();
+    CHECK(ecs.getComponent<RigidBodyComponent>(entity)->position.x == 3.0f);
+}
@@ -0,0 +1,235 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <physics/ContactManifold.hpp>
+#include <physics/ContactSolver.hpp>
+#include <random>
+#include <utils/ThreadPool.hpp>
+#include <vector>
+
+#include "Test.hpp"
+
+// Constraint coloring, warm starting and manifold point management
+namespace {
+    using omelette::physics::Contact;
+    using omelette::physics::ContactManifold;
+    using omelette::physics::ContactSolver;
+    using omelette::physics::SolverSettings;
+    using omelette::utils::Vec3;
+
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+    constexpr float GRAVITY = 9.81f;
+
+    // Contact from a point on A to a point on B, with normal +y
+    Contact contactAt(float x, float z, float depth) {
+        Contact contact;
+        contact.normal = Vec3(0.0f, 1.0f, 0.0f);
+        contact.depth = depth;
+        contact.pointA = Vec3(x, depth, z);
+        contact.pointB = Vec3(x, 0.0f, z);
+        return contact;
+    }
+
+    // Manifold with a single touching point at the origin
+    ContactManifold touchingManifold() {
+        ContactManifold manifold;
+        manifold.addContact(contactAt(0.0f, 0.0f, 0.0f), Vec3(), Vec3());
+        return manifold;
+    }
+
+    // Check that no batch below MAX_COLORS uses a dynamic body twice and
+    // that every constraint is in exactly one batch
+    void checkColoring(
+        const ContactSolver& solver,
+        const std::vector<ContactSolver::Body>& bodies,
+        const std::vector<ContactSolver::Constraint>& constraints
+    ) {
+        const auto& order = solver.getBatchOrder();
+        const auto& offsets = solver.getBatchOffsets();
+        CHECK(offsets.size() == ContactSolver::MAX_COLORS + 2);
+        CHECK(order.size() == constraints.size());
+
+        std::vector<int> seen(constraints.size(), 0);
+        for (uint32_t index : order) {
+            seen[index]++;
+        }
+        for (int count : seen) {
+            CHECK(count == 1);
+        }
+
+        std::vector<size_t> lastBatch(bodies.size(), SIZE_MAX);
+        for (size_t batch = 0; batch < ContactSolver::MAX_COLORS; batch++) {
+            for (size_t i = offsets[batch]; i < offsets[batch + 1]; i++) {
+                const auto& constraint = constraints[order[i]];
+                for (uint32_t body : {constraint.bodyA, constraint.bodyB}) {
+                    if (bodies[body].inverseMass <= 0.0f) {
+                        continue;
+                    }
+                    CHECK(lastBatch[body] != batch);
+                    lastBatch[body] = batch;
+                }
+            }
+        }
+    }
+} // namespace
+
+OMELETTE_TEST(contact_solver, coloring_separates_dynamic_bodies) {
+    omelette::utils::ThreadPool threadPool(2);
+    std::mt19937 random(3);
+
+    // Body 0 is static ground shared by many constraints
+    std::vector<ContactSolver::Body> bodies(200, {Vec3(), 1.0f, Vec3()});
+    bodies[0].inverseMass = 0.0f;
+
+    std::uniform_int_distribution<uint32_t> pick(0, 199);
+    std::vector<ContactManifold> manifolds(1000, touchingManifold());
+    std::vector<ContactSolver::Constraint> constraints;
+    for (auto& manifold : manifolds) {
+        uint32_t a = pick(random) % 4 == 0 ? 0 : pick(random);
+        uint32_t b = pick(random);
+        while (b == a) {
+            b = pick(random);
+        }
+        constraints.push_back({a, b, &manifold});
+    }
+
+    ContactSolver solver;
+    solver.solve(bodies, constraints, DELTA_TIME, threadPool);
+    checkColoring(solver, bodies, constraints);
+}
+
+OMELETTE_TEST(contact_solver, coloring_overflows_to_serial_batch) {
+    omelette::utils::ThreadPool threadPool(2);
+
+    // One dynamic hub touching more bodies than there are colors, and
+    // static ground under every body, which never takes a color
+    const size_t spokes = ContactSolver::MAX_COLORS + 6;
+    std::vector<ContactSolver::Body> bodies(spokes + 2, {Vec3(), 1.0f, Vec3()});
+    const uint32_t ground = static_cast<uint32_t>(spokes + 1);
+    bodies[ground].inverseMass = 0.0f;
+
+    std::vector<ContactManifold> manifolds(spokes * 2, touchingManifold());
+    std::vector<ContactSolver::Constraint> constraints;
+    for (uint32_t i = 1; i <= spokes; i++) {
+        constraints.push_back({0, i, &manifolds[i - 1]});
+        constraints.push_back({ground, i, &manifolds[spokes + i - 1]});
+    }
+
+    ContactSolver solver;
+    solver.solve(bodies, constraints, DELTA_TIME, threadPool);
+    checkColoring(solver, bodies, constraints);
+
+    const auto& offsets = solver.getBatchOffsets();
+    const size_t overflow = ContactSolver::MAX_COLORS;
+    CHECK(offsets[overflow + 1] - offsets[overflow] == 6);
+}
+
+OMELETTE_TEST(contact_solver, second_solve_warm_starts) {
+    omelette::utils::ThreadPool threadPool(1);
+
+    // A body resting on static ground, pulled down by one step of gravity
+    std::vector<ContactSolver::Body> bodies = {
+        {Vec3(), 0.0f, Vec3()},
+        {Vec3(0.0f, -GRAVITY * DELTA_TIME, 0.0f), 1.0f, Vec3()}
+    };
+    ContactManifold manifold = touchingManifold();
+    const std::vector<ContactSolver::Constraint> constraints = {
+        {0, 1, &manifold}
+    };
+
+    ContactSolver solver;
+    solver.solve(bodies, constraints, DELTA_TIME, threadPool);
+    CHECK_NEAR(bodies[1].velocity.y, 0.0, 1e-5);
+    CHECK_NEAR(manifold.points[0].normalImpulse, GRAVITY * DELTA_TIME, 1e-5);
+
+    // With no iterations, the warm start alone must cancel gravity again
+    SolverSettings settings;
+    settings.iterations = 0;
+    settings.positionIterations = 0;
+    solver.setSettings(settings);
+    bodies[1].velocity = Vec3(0.0f, -GRAVITY * DELTA_TIME, 0.0f);
+    solver.solve(bodies, constraints, DELTA_TIME, threadPool);
+    CHECK(manifold.points[0].normalImpulse > 0.0f);
+    CHECK_NEAR(bodies[1].velocity.y, 0.0, 1e-5);
+
+    // Without warm starting the body keeps falling
+    settings.warmStarting = false;
+    solver.setSettings(settings);
+    bodies[1].velocity = Vec3(0.0f, -GRAVITY * DELTA_TIME, 0.0f);
+    solver.solve(bodies, constraints, DELTA_TIME, threadPool);
+    CHECK_NEAR(bodies[1].velocity.y, -GRAVITY * DELTA_TIME, 1e-6);
+}
+
+OMELETTE_TEST(contact_solver, manifold_keeps_four_points) {
+    ContactManifold manifold;
+    const Vec3 origin;
+
+    // Corners of a square, one deep point in the middle, then more
+    const float points[][3] = {
+        {-0.5f, -0.5f, 0.01f},
+        {0.5f, -0.5f, 0.01f},
+        {0.5f, 0.5f, 0.01f},
+        {-0.5f, 0.5f, 0.01f},
+        {0.0f, 0.0f, 0.05f},
+        {0.1f, 0.2f, 0.01f},
+        {-0.2f, 0.1f, 0.01f},
+    };
+    for (const auto& point : points) {
+        manifold.addContact(
+            contactAt(point[0], point[1], point[2]),
+            origin,
+            origin
+        );
+        CHECK(manifold.pointCount <= ContactManifold::MAX_POINTS);
+    }
+    CHECK(manifold.pointCount == ContactManifold::MAX_POINTS);
+
+    // The deepest point is always kept
+    bool keptDeepest = false;
+    for (int i = 0; i < manifold.pointCount; i++) {
+        keptDeepest = keptDeepest || manifold.points[i].depth == 0.05f;
+    }
+    CHECK(keptDeepest);
+
+    // A contact next to an existing point replaces it and keeps its
+    // impulse
+    manifold.points[0].normalImpulse = 2.0f;
+    const Vec3 anchor = manifold.points[0].localA;
+    manifold.addContact(
+        contactAt(anchor.x + 0.005f, anchor.z, anchor.y),
+        origin,
+        origin
+    );
+    CHECK(manifold.pointCount == ContactManifold::MAX_POINTS);
+    CHECK(manifold.points[0].normalImpulse == 2.0f);
+    CHECK_NEAR(manifold.points[0].localA.x, anchor.x + 0.005f, 1e-6);
+}
+
+OMELETTE_TEST(contact_solver, manifold_drops_drifting_points) {
+    const float breakDistance = ContactManifold::BREAK_DISTANCE;
+    auto fourPoints = []() {
+        ContactManifold manifold;
+        for (float x : {-0.5f, 0.5f}) {
+            for (float z : {-0.5f, 0.5f}) {
+                manifold.addContact(contactAt(x, z, 0.01f), Vec3(), Vec3());
+            }
+        }
+        return manifold;
+    };
+
+    // Small motion keeps every point and updates its depth
+    ContactManifold manifold = fourPoints();
+    manifold.refresh(Vec3(), Vec3(0.5f * breakDistance, 0.005f, 0.0f));
+    CHECK(manifold.pointCount == 4);
+    CHECK_NEAR(manifold.points[0].depth, 0.005, 1e-6);
+
+    // Sliding past the break distance drops every point
+    manifold = fourPoints();
+    manifold.refresh(Vec3(), Vec3(0.0f, 0.0f, 1.5f * breakDistance));
+    CHECK(manifold.pointCount == 0);
+
+    // So does separating past it along the normal
+    manifold = fourPoints();
+    manifold.refresh(Vec3(), Vec3(0.0f, 0.01f + 1.5f * breakDistance, 0.0f));
+    CHECK(manifold.pointCount == 0);
+}
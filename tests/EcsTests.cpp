@@ -0,0 +1,141 @@
+#include <ecs/Components/ColliderComponent.hpp>
+#include <ecs/Components/RigidBodyComponent.hpp>
+#include <ecs/ECS.hpp>
+#include <physics/Shape.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "Test.hpp"
+
+// Entity handles and archetype storage
+namespace {
+    using omelette::ecs::ECS;
+    using omelette::ecs::Entity;
+    using omelette::ecs::components::ColliderComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+    using omelette::utils::Vec3;
+
+    // Body whose x position identifies it
+    RigidBodyComponent bodyAt(float x) {
+        return RigidBodyComponent(Vec3(x, 0.0f, 0.0f), Vec3(), Vec3(), 1.0f);
+    }
+
+    ColliderComponent unitSphere() {
+        return ColliderComponent(omelette::physics::Shape::sphere(1.0f));
+    }
+} // namespace
+
+OMELETTE_TEST(ecs, stale_handles_are_rejected) {
+    ECS ecs;
+    const Entity entity = ecs.createEntity();
+    ecs.addComponentToEntity(entity, bodyAt(1.0f));
+    ecs.destroyEntity(entity);
+
+    // The slot is recycled with a new generation
+    const Entity recycled = ecs.createEntity();
+    ecs.addComponentToEntity(recycled, bodyAt(2.0f));
+    CHECK(recycled.index() == entity.index());
+    CHECK(recycled.generation() != entity.generation());
+
+    CHECK(!ecs.isAlive(entity));
+    CHECK(ecs.isAlive(recycled));
+    CHECK(ecs.getComponent<RigidBodyComponent>(entity) == nullptr);
+    CHECK(!ecs.hasComponent<RigidBodyComponent>(entity));
+    CHECK(!ecs.removeComponentFromEntity<RigidBodyComponent>(entity));
+
+    bool threw = false;
+    try {
+        ecs.addComponentToEntity(entity, bodyAt(3.0f));
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    CHECK(threw);
+
+    // Destroying through the stale handle leaves the new entity alone
+    ecs.destroyEntity(entity);
+    CHECK(ecs.isAlive(recycled));
+    CHECK(ecs.getComponent<RigidBodyComponent>(recycled)->position.x == 2.0f);
+    CHECK(Entity().isNull() && !ecs.isAlive(Entity()));
+}
+
+OMELETTE_TEST(ecs, generation_wraps_instead_of_retiring) {
+    ECS ecs;
+    Entity previous = ecs.createEntity();
+    const uint32_t index = previous.index();
+
+    // Recycle one slot past a full generation cycle
+    for (uint32_t i = 0; i <= Entity::GENERATION_MASK + 1; i++) {
+        ecs.destroyEntity(previous);
+        const Entity next = ecs.createEntity();
+        CHECK(next.index() == index);
+        CHECK(!ecs.isAlive(previous));
+        CHECK(ecs.isAlive(next));
+        previous = next;
+    }
+    CHECK(ecs.getEntities().size() == 1);
+    CHECK(ecs.getEntityCapacity() == 1);
+}
+
+OMELETTE_TEST(ecs, destroy_swaps_last_row_in) {
+    ECS ecs;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4; i++) {
+        const Entity entity = ecs.createEntity();
+        ecs.addComponentToEntity(entity, bodyAt(float(i)));
+        ecs.addComponentToEntity(entity, unitSphere());
+        entities.push_back(entity);
+    }
+
+    // Removing a middle row moves the last row into it
+    ecs.destroyEntity(entities[1]);
+    CHECK(ecs.getEntities().size() == 3);
+    for (int i : {0, 2, 3}) {
+        const auto* body = ecs.getComponent<RigidBodyComponent>(entities[i]);
+        CHECK(body && body->position.x == float(i));
+        CHECK(ecs.hasComponent<ColliderComponent>(entities[i]));
+    }
+
+    size_t visited = 0;
+    float sum = 0.0f;
+    ecs.view<const RigidBodyComponent, const ColliderComponent>().each(
+        [&](const RigidBodyComponent& body, const ColliderComponent&) {
+            visited++;
+            sum += body.position.x;
+        }
+    );
+    CHECK(visited == 3);
+    CHECK(sum == 5.0f);
+}
+
+OMELETTE_TEST(ecs, remove_component_keeps_the_others) {
+    ECS ecs;
+    const Entity first = ecs.createEntity();
+    const Entity second = ecs.createEntity();
+    ecs.addComponentToEntity(first, bodyAt(1.0f));
+    ecs.addComponentToEntity(first, unitSphere());
+    ecs.addComponentToEntity(second, bodyAt(2.0f));
+    ecs.addComponentToEntity(second, unitSphere());
+
+    CHECK(ecs.removeComponentFromEntity<ColliderComponent>(first));
+    CHECK(!ecs.removeComponentFromEntity<ColliderComponent>(first));
+    CHECK(!ecs.hasComponent<ColliderComponent>(first));
+    CHECK(ecs.getComponent<RigidBodyComponent>(first)->position.x == 1.0f);
+    CHECK(ecs.getComponent<RigidBodyComponent>(second)->position.x == 2.0f);
+    CHECK(ecs.hasComponent<ColliderComponent>(second));
+    CHECK(ecs.view<ColliderComponent>().size() == 1);
+}
+
+OMELETTE_TEST(ecs, bulk_create_and_destroy) {
+    ECS ecs;
+    const auto entities = ecs.createEntities(100, bodyAt(4.0f), unitSphere());
+    CHECK(entities.size() == 100);
+    const auto view = ecs.view<RigidBodyComponent, ColliderComponent>();
+    CHECK(view.size() == 100);
+    const auto* body = ecs.getComponent<RigidBodyComponent>(entities[57]);
+    CHECK(body && body->position.x == 4.0f);
+
+    ecs.destroyEntities({entities.begin(), entities.begin() + 40});
+    CHECK(ecs.getEntities().size() == 60);
+    CHECK(!ecs.isAlive(entities[0]));
+    CHECK(ecs.isAlive(entities[99]));
+}
@@ -0,0 +1,155 @@
+#include <memory>
+#include <physics/ConvexHull.hpp>
+#include <physics/Narrowphase.hpp>
+#include <physics/Shape.hpp>
+#include <tuple>
+#include <utils/IndexBuffer.hpp>
+#include <utils/Shapes.hpp>
+
+#include "Test.hpp"
+
+// GJK/EPA (collideConvex) checked against the analytic sphere and box
+// tests, which have closed-form answers
+namespace {
+    using omelette::physics::Contact;
+    using omelette::physics::Shape;
+    using omelette::utils::Vec3;
+    namespace Narrowphase = omelette::physics::Narrowphase;
+
+    // EPA stops within its tolerance of the true depth
+    constexpr double DEPTH_TOLERANCE = 1e-3;
+
+    // Box with the given half extents as a convex hull, so it takes the
+    // GJK/EPA path instead of the analytic one
+    Shape hullBox(const Vec3& halfExtents) {
+        auto [vertices, indices] = omelette::utils::Shapes::createCube(
+            halfExtents.x * 2.0f,
+            halfExtents.y * 2.0f,
+            halfExtents.z * 2.0f
+        );
+        return Shape::convexHull(
+            std::make_shared<const omelette::physics::ConvexHull>(
+                vertices,
+                omelette::utils::IndexBuffer(std::move(indices))
+            )
+        );
+    }
+
+    // Check that two contacts agree on normal and depth
+    void checkSameContact(const Contact& actual, const Contact& expected) {
+        CHECK_NEAR(actual.depth, expected.depth, DEPTH_TOLERANCE);
+        CHECK_NEAR(actual.normal.x, expected.normal.x, 1e-3);
+        CHECK_NEAR(actual.normal.y, expected.normal.y, 1e-3);
+        CHECK_NEAR(actual.normal.z, expected.normal.z, 1e-3);
+    }
+} // namespace
+
+OMELETTE_TEST(narrowphase, spheres_match_analytic) {
+    const Shape a = Shape::sphere(1.0f);
+    const Shape b = Shape::sphere(0.5f);
+    const Vec3 positionA(0.0f, 0.0f, 0.0f);
+
+    for (const Vec3& positionB :
+         {Vec3(1.2f, 0.0f, 0.0f), Vec3(0.3f, 0.9f, -0.4f)}) {
+        Contact expected;
+        Contact actual;
+        CHECK(Narrowphase::collideSpheres(
+            1.0f,
+            positionA,
+            0.5f,
+            positionB,
+            expected
+        ));
+        CHECK(Narrowphase::collideConvex(a, positionA, b, positionB, actual));
+        checkSameContact(actual, expected);
+    }
+
+    Contact contact;
+    CHECK(!Narrowphase::collideConvex(
+        a,
+        positionA,
+        b,
+        Vec3(1.6f, 0.0f, 0.0f),
+        contact
+    ));
+}
+
+OMELETTE_TEST(narrowphase, boxes_match_analytic) {
+    const Vec3 halfExtentsA(0.5f, 0.5f, 0.5f);
+    const Vec3 halfExtentsB(1.0f, 0.25f, 0.5f);
+    const Shape a = hullBox(halfExtentsA);
+    const Shape b = hullBox(halfExtentsB);
+    const Vec3 positionA(0.0f, 0.0f, 0.0f);
+
+    // Overlaps whose shallowest axis is y, x and z in turn
+    for (const Vec3& positionB :
+         {Vec3(0.3f, 0.6f, 0.1f),
+          Vec3(-1.3f, 0.1f, 0.2f),
+          Vec3(0.2f, -0.1f, 0.85f)}) {
+        Contact expected;
+        Contact actual;
+        CHECK(Narrowphase::collideBoxes(
+            halfExtentsA,
+            positionA,
+            halfExtentsB,
+            positionB,
+            expected
+        ));
+        CHECK(Narrowphase::collideConvex(a, positionA, b, positionB, actual));
+        checkSameContact(actual, expected);
+    }
+
+    Contact contact;
+    CHECK(!Narrowphase::collideConvex(
+        a,
+        positionA,
+        b,
+        Vec3(0.0f, 0.8f, 0.0f),
+        contact
+    ));
+    CHECK(!Narrowphase::intersect(a, positionA, b, Vec3(0.0f, 0.8f, 0.0f)));
+    CHECK(Narrowphase::intersect(a, positionA, b, Vec3(0.0f, 0.7f, 0.0f)));
+}
+
+OMELETTE_TEST(narrowphase, sphere_box_matches_analytic) {
+    const Vec3 halfExtents(0.5f, 0.5f, 0.5f);
+    const Shape sphere = Shape::sphere(0.5f);
+    const Shape box = hullBox(halfExtents);
+    const Vec3 boxPosition(0.0f, 0.0f, 0.0f);
+
+    // Center outside the box (GJK distance) and inside it (EPA)
+    for (const Vec3& spherePosition :
+         {Vec3(0.1f, 0.8f, 0.2f), Vec3(0.05f, 0.3f, 0.0f)}) {
+        Contact expected;
+        Contact actual;
+        CHECK(Narrowphase::collideSphereBox(
+            0.5f,
+            spherePosition,
+            halfExtents,
+            boxPosition,
+            expected
+        ));
+        CHECK(Narrowphase::collideConvex(
+            sphere,
+            spherePosition,
+            box,
+            boxPosition,
+            actual
+        ));
+        checkSameContact(actual, expected);
+    }
+}
+
+OMELETTE_TEST(narrowphase, warm_start_keeps_result) {
+    const Shape a = hullBox(Vec3(0.5f, 0.5f, 0.5f));
+    const Vec3 positionB(0.3f, 0.9f, 0.1f);
+    omelette::physics::NarrowphaseCache cache;
+
+    Contact first;
+    Contact second;
+    CHECK(Narrowphase::collideConvex(a, Vec3(), a, positionB, first, &cache));
+    CHECK(Narrowphase::collideConvex(a, Vec3(), a, positionB, second, &cache));
+    checkSameContact(second, first);
+    CHECK_NEAR(first.depth, 0.1, DEPTH_TOLERANCE);
+    CHECK_NEAR(first.normal.y, 1.0, 1e-3);
+}
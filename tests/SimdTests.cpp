@@ -0,0 +1,192 @@
+#include <cstring>
+#include <ecs/Components/RigidBodyComponent.hpp>
+#include <glm/glm.hpp>
+#include <physics/Integrator.hpp>
+#include <utils/Simd.hpp>
+#include <utils/Vec3.hpp>
+#include <utils/VertexTransform.hpp>
+#include <vector>
+
+#include "Test.hpp"
+
+// Every SIMD kernel the CPU supports must give the scalar kernel's results
+// bit for bit. The counts are not multiples of the vector widths, so the
+// scalar tails are covered as well.
+namespace {
+    using omelette::utils::SimdLevel;
+    using omelette::utils::Vec3;
+    namespace Integrator = omelette::physics::Integrator;
+    namespace VertexTransform = omelette::utils::VertexTransform;
+
+    constexpr size_t COUNT = 37;
+
+    // Every kernel the running CPU supports, scalar included
+    std::vector<SimdLevel> getSupportedLevels() {
+        std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+        const SimdLevel best = omelette::utils::getSimdLevel();
+        if (best == SimdLevel::SSE2 || best == SimdLevel::AVX) {
+            levels.push_back(SimdLevel::SSE2);
+        }
+        if (best == SimdLevel::AVX) {
+            levels.push_back(SimdLevel::AVX);
+        }
+        return levels;
+    }
+
+    // Arbitrary but repeatable values with varied exponents and signs
+    float sample(size_t i, size_t stream) {
+        const float value = float((i * 7919 + stream * 104729) % 2003);
+        return (value - 1001.0f) / float(1 + (i + stream) % 13);
+    }
+
+    // SoA body state owning its arrays
+    struct Bodies {
+        std::vector<float> arrays[9];
+
+        Bodies() {
+            for (size_t a = 0; a < 9; a++) {
+                arrays[a].resize(COUNT);
+                for (size_t i = 0; i < COUNT; i++) {
+                    arrays[a][i] = sample(i, a);
+                }
+            }
+        }
+
+        Integrator::BodyArrays view() {
+            return {
+                arrays[0].data(),
+                arrays[1].data(),
+                arrays[2].data(),
+                arrays[3].data(),
+                arrays[4].data(),
+                arrays[5].data(),
+                arrays[6].data(),
+                arrays[7].data(),
+                arrays[8].data(),
+                COUNT
+            };
+        }
+
+        bool operator==(const Bodies& other) const {
+            for (size_t a = 0; a < 9; a++) {
+                if (std::memcmp(
+                        arrays[a].data(),
+                        other.arrays[a].data(),
+                        COUNT * sizeof(float)
+                    ) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+} // namespace
+
+OMELETTE_TEST(simd, integrate_matches_scalar) {
+    Bodies expected;
+    for (int step = 0; step < 3; step++) {
+        Integrator::integrate(expected.view(), 1.0f / 60.0f, SimdLevel::Scalar);
+    }
+
+    for (SimdLevel level : getSupportedLevels()) {
+        Bodies actual;
+        for (int step = 0; step < 3; step++) {
+            Integrator::integrate(actual.view(), 1.0f / 60.0f, level);
+        }
+        CHECK(actual == expected);
+    }
+}
+
+OMELETTE_TEST(simd, integrate_components_matches_kernels) {
+    Bodies expected;
+    Integrator::integrate(expected.view(), 1.0f / 60.0f, SimdLevel::Scalar);
+
+    // The same state as components, integrated in place
+    using omelette::ecs::components::RigidBodyComponent;
+    Bodies initial;
+    std::vector<RigidBodyComponent> components;
+    for (size_t i = 0; i < COUNT; i++) {
+        const auto& arrays = initial.arrays;
+        components.emplace_back(
+            Vec3(arrays[0][i], arrays[1][i], arrays[2][i]),
+            Vec3(arrays[3][i], arrays[4][i], arrays[5][i]),
+            Vec3(arrays[6][i], arrays[7][i], arrays[8][i]),
+            1.0f
+        );
+    }
+    Integrator::integrate(components.data(), COUNT, 1.0f / 60.0f);
+
+    Bodies actual;
+    for (size_t i = 0; i < COUNT; i++) {
+        const Vec3* vectors[] = {
+            &components[i].position,
+            &components[i].velocity,
+            &components[i].acceleration
+        };
+        for (size_t v = 0; v < 3; v++) {
+            actual.arrays[v * 3][i] = vectors[v]->x;
+            actual.arrays[v * 3 + 1][i] = vectors[v]->y;
+            actual.arrays[v * 3 + 2][i] = vectors[v]->z;
+        }
+    }
+    CHECK(actual == expected);
+}
+
+OMELETTE_TEST(simd, vertex_transform_matches_scalar) {
+    // Rotation, scale and translation with no zero entries
+    glm::mat4 matrix(1.0f);
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 3; row++) {
+            matrix[column][row] = sample(size_t(column * 4 + row), 9) / 500.0f;
+        }
+    }
+
+    std::vector<Vec3> input(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        input[i] = Vec3(sample(i, 10), sample(i, 11), sample(i, 12));
+    }
+
+    std::vector<Vec3> expected(COUNT);
+    VertexTransform::transform(
+        matrix,
+        input.data(),
+        expected.data(),
+        COUNT,
+        SimdLevel::Scalar
+    );
+
+    for (SimdLevel level : getSupportedLevels()) {
+        std::vector<Vec3> actual(COUNT);
+        VertexTransform::transform(
+            matrix,
+            input.data(),
+            actual.data(),
+            COUNT,
+            level
+        );
+        CHECK(
+            std::memcmp(
+                actual.data(),
+                expected.data(),
+                COUNT * sizeof(Vec3)
+            ) == 0
+        );
+
+        // Transforming in place gives the same result
+        std::vector<Vec3> inPlace = input;
+        VertexTransform::transform(
+            matrix,
+            inPlace.data(),
+            inPlace.data(),
+            COUNT,
+            level
+        );
+        CHECK(
+            std::memcmp(
+                inPlace.data(),
+                expected.data(),
+                COUNT * sizeof(Vec3)
+            ) == 0
+        );
+    }
+}
@@ -0,0 +1,169 @@
+#include <ecs/Components/ColliderComponent.hpp>
+#include <ecs/Components/RigidBodyComponent.hpp>
+#include <ecs/ECS.hpp>
+#include <ecs/Scheduler.hpp>
+#include <ecs/System.hpp>
+#include <ecs/Systems/BroadphaseSystem.hpp>
+#include <ecs/Systems/ContactSolverSystem.hpp>
+#include <ecs/Systems/IntegrationSystem.hpp>
+#include <ecs/Systems/IslandSystem.hpp>
+#include <ecs/Systems/NarrowphaseSystem.hpp>
+#include <physics/Shape.hpp>
+
+#include "Test.hpp"
+
+// Islands falling asleep and waking, through the full physics pipeline
+namespace {
+    using omelette::ecs::ECS;
+    using omelette::ecs::Entity;
+    using omelette::ecs::components::ColliderComponent;
+    using omelette::ecs::components::RigidBodyComponent;
+    using omelette::utils::Vec3;
+    namespace systems = omelette::ecs::systems;
+
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+    bool equal(const Vec3& a, const Vec3& b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+
+    // Gravity as a force that does not wake sleeping bodies
+    class GravitySystem: public omelette::ecs::System {
+      public:
+        omelette::ecs::ComponentAccess getAccess() const override {
+            return omelette::ecs::ComponentAccess()
+                .write<RigidBodyComponent>();
+        }
+
+        void update(ECS& ecs, float, omelette::utils::ThreadPool&) override {
+            ecs.view<RigidBodyComponent>().each([](RigidBodyComponent& body) {
+                if (body.mass > 0.0f) {
+                    const Vec3 weight(0.0f, -9.81f * body.mass, 0.0f);
+                    body.applyForce(weight, false);
+                }
+            });
+        }
+    };
+
+    // Static ground with its top face at y = 0, and the physics pipeline
+    struct Scene {
+        ECS ecs;
+        omelette::ecs::Scheduler scheduler{1};
+        systems::IslandSystem* islands = nullptr;
+
+        Scene() {
+            addBox(Vec3(0.0f, -0.5f, 0.0f), Vec3(10.0f, 0.5f, 10.0f), 0.0f);
+
+            scheduler.addSystem<GravitySystem>();
+            auto& broadphase =
+                scheduler.addSystem<systems::BroadphaseSystem>();
+            auto& narrowphase =
+                scheduler.addSystem<systems::NarrowphaseSystem>(broadphase);
+            islands = &scheduler.addSystem<systems::IslandSystem>(narrowphase);
+            scheduler.addSystem<systems::ContactSolverSystem>(narrowphase);
+            scheduler.addSystem<systems::IntegrationSystem>();
+        }
+
+        Entity
+        addBox(const Vec3& position, const Vec3& halfExtents, float mass) {
+            const Entity entity = ecs.createEntity();
+            ecs.addComponentToEntity(
+                entity,
+                ColliderComponent(omelette::physics::Shape::box(halfExtents))
+            );
+            ecs.addComponentToEntity(
+                entity,
+                RigidBodyComponent(position, Vec3(), Vec3(), mass)
+            );
+            return entity;
+        }
+
+        // Unit cube resting on the ground, or on top of another cube
+        Entity addCube(float height) {
+            const Vec3 halfExtents(0.5f, 0.5f, 0.5f);
+            return addBox(Vec3(0.0f, height, 0.0f), halfExtents, 1.0f);
+        }
+
+        void step(int count = 1) {
+            for (int i = 0; i < count; i++) {
+                scheduler.run(ecs, DELTA_TIME);
+            }
+        }
+
+        RigidBodyComponent& body(Entity entity) {
+            return *ecs.getComponent<RigidBodyComponent>(entity);
+        }
+
+        // Steps of timeToSleep, rounded up, plus a margin for settling
+        int stepsToSleep() const {
+            return int(islands->getSettings().timeToSleep / DELTA_TIME) + 10;
+        }
+    };
+} // namespace
+
+OMELETTE_TEST(sleep, resting_body_falls_asleep) {
+    Scene scene;
+    const Entity cube = scene.addCube(0.5f);
+
+    // Still awake halfway through timeToSleep
+    scene.step(scene.stepsToSleep() / 2 - 5);
+    CHECK(!scene.body(cube).sleeping);
+
+    scene.step(scene.stepsToSleep());
+    CHECK(scene.body(cube).sleeping);
+    CHECK(scene.islands->getSleepingCount() == 1);
+
+    // Sleeping bodies do not move
+    const Vec3 position = scene.body(cube).position;
+    scene.step(10);
+    CHECK(scene.body(cube).sleeping);
+    CHECK(equal(scene.body(cube).position, position));
+    CHECK_NEAR(position.y, 0.5, 0.02);
+}
+
+OMELETTE_TEST(sleep, awake_body_wakes_touched_island) {
+    Scene scene;
+    const Entity bottom = scene.addCube(0.5f);
+    scene.step(scene.stepsToSleep() * 2);
+    CHECK(scene.body(bottom).sleeping);
+
+    // Drop a cube onto the sleeper; it must wake when they touch
+    const Entity top = scene.addCube(2.0f);
+    bool woke = false;
+    for (int i = 0; i < 60 && !woke; i++) {
+        scene.step();
+        woke = !scene.body(bottom).sleeping;
+    }
+    CHECK(woke);
+    CHECK(!scene.body(top).sleeping);
+
+    // The stack then settles and sleeps as one island
+    scene.step(scene.stepsToSleep() * 3);
+    CHECK(scene.body(bottom).sleeping);
+    CHECK(scene.body(top).sleeping);
+    CHECK(scene.body(top).position.y > scene.body(bottom).position.y + 0.9f);
+}
+
+OMELETTE_TEST(sleep, apply_force_wakes_unless_told_not_to) {
+    Scene scene;
+    const Entity cube = scene.addCube(0.5f);
+    scene.step(scene.stepsToSleep() * 2);
+    CHECK(scene.body(cube).sleeping);
+
+    // A force that must not wake the body is dropped
+    RigidBodyComponent& body = scene.body(cube);
+    const Vec3 position = body.position;
+    body.applyForce(Vec3(100.0f, 0.0f, 0.0f), false);
+    CHECK(body.sleeping);
+    CHECK(equal(body.acceleration, Vec3()));
+    scene.step();
+    CHECK(scene.body(cube).sleeping);
+    CHECK(equal(scene.body(cube).position, position));
+
+    // The default wakes it and the push moves it
+    scene.body(cube).applyForce(Vec3(100.0f, 0.0f, 0.0f));
+    CHECK(!scene.body(cube).sleeping);
+    scene.step();
+    CHECK(!scene.body(cube).sleeping);
+    CHECK(scene.body(cube).position.x > position.x);
+}
@@ -0,0 +1,61 @@
+#include "Test.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace omelette::tests {
+    namespace {
+        // Failed checks of the running test
+        int failures = 0;
+    } // namespace
+
+    /* Get Tests
+    - Returns: Every registered test case. Kept in a function-local static
+      so registration from other files' static initializers is safe. */
+    std::vector<TestCase>& getTests() {
+        static std::vector<TestCase> tests;
+        return tests;
+    }
+
+    /* Fail
+    - Prints a failed check and counts it against the running test.
+    - Parameters:
+        - file, line: Where the check is.
+        - message: What was checked. */
+    void fail(const char* file, int line, const std::string& message) {
+        std::fprintf(stderr, "  %s:%d: %s\n", file, line, message.c_str());
+        failures++;
+    }
+}; // namespace omelette::tests
+
+/* Main
+- Runs the tests of the group named by the first argument, or every test.
+- Returns: 0 if every check passed, 1 otherwise. */
+int main(int argc, char** argv) {
+    const char* group = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    int failed = 0;
+    for (const auto& test : omelette::tests::getTests()) {
+        if (group && std::strcmp(group, test.group) != 0) {
+            continue;
+        }
+        omelette::tests::failures = 0;
+        test.function();
+        run++;
+        const bool passed = omelette::tests::failures == 0;
+        failed += passed ? 0 : 1;
+        std::printf(
+            "[%s] %s.%s\n",
+            passed ? " OK " : "FAIL",
+            test.group,
+            test.name
+        );
+    }
+
+    if (run == 0) {
+        std::fprintf(stderr, "No tests in group %s\n", group ? group : "");
+        return 1;
+    }
+    std::printf("%d of %d tests passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}
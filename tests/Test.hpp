@@ -0,0 +1,61 @@
+#ifndef OMELETTE_TESTS_TEST_HPP
+#define OMELETTE_TESTS_TEST_HPP
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Minimal test registry: OMELETTE_TEST defines a test function and
+// registers it under a group, which meson runs as one test each.
+namespace omelette::tests {
+    struct TestCase {
+        const char* group; // Group the test belongs to
+        const char* name; // Name of the test
+        void (*function)(); // Body of the test
+    };
+
+    // Every registered test, in registration order
+    std::vector<TestCase>& getTests();
+
+    // Report a failed check of the running test
+    void fail(const char* file, int line, const std::string& message);
+
+    // Registers a test from a static initializer
+    struct Registrar {
+        Registrar(const char* group, const char* name, void (*function)()) {
+            getTests().push_back({group, name, function});
+        }
+    };
+}; // namespace omelette::tests
+
+#define OMELETTE_TEST(group, name) \
+    static void test_##group##_##name(); \
+    static const omelette::tests::Registrar registrar_##group##_##name( \
+        #group, \
+        #name, \
+        test_##group##_##name \
+    ); \
+    static void test_##group##_##name()
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            omelette::tests::fail(__FILE__, __LINE__, #condition); \
+        } \
+    } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        const double checkActual = (actual); \
+        const double checkExpected = (expected); \
+        if (!(std::fabs(checkActual - checkExpected) <= (tolerance))) { \
+            omelette::tests::fail( \
+                __FILE__, \
+                __LINE__, \
+                std::string(#actual " = ") + std::to_string(checkActual) \
+                    + ", expected " + std::to_string(checkExpected) \
+            ); \
+        } \
+    } while (false)
+
+#endif // OMELETTE_TESTS_TEST_HPP
@@ -0,0 +1,71 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utils/ThreadPool.hpp>
+
+#include "Test.hpp"
+
+// Task exceptions are kept in their group and rethrown by wait()
+namespace {
+    using omelette::utils::TaskGroup;
+    using omelette::utils::ThreadPool;
+
+    // Run a callable, returning whether it threw std::out_of_range
+    template<typename Function>
+    bool throwsOutOfRange(Function&& function) {
+        try {
+            function();
+        } catch (const std::out_of_range&) {
+            return true;
+        }
+        return false;
+    }
+} // namespace
+
+OMELETTE_TEST(thread_pool, wait_rethrows_after_group_drains) {
+    ThreadPool threadPool(4);
+    std::atomic<size_t> finished{0};
+    TaskGroup group;
+    for (size_t i = 0; i < 64; i++) {
+        threadPool.submit(
+            [&finished, i]() {
+                if (i % 16 == 3) {
+                    throw std::out_of_range("task failed");
+                }
+                finished.fetch_add(1, std::memory_order_relaxed);
+            },
+            group
+        );
+    }
+
+    CHECK(throwsOutOfRange([&]() { threadPool.wait(group); }));
+    CHECK(group.isDone());
+    CHECK(finished.load() == 60);
+
+    // The exception is cleared once rethrown
+    CHECK(!throwsOutOfRange([&]() { threadPool.wait(group); }));
+}
+
+OMELETTE_TEST(thread_pool, parallel_for_finishes_every_chunk) {
+    ThreadPool threadPool(4);
+    for (size_t throwing : {size_t(0), size_t(500), size_t(999)}) {
+        std::atomic<size_t> visited{0};
+        const bool threw = throwsOutOfRange([&]() {
+            threadPool.parallelFor(1000, 10, [&](size_t begin, size_t end) {
+                visited.fetch_add(end - begin, std::memory_order_relaxed);
+                if (begin <= throwing && throwing < end) {
+                    throw std::out_of_range("chunk failed");
+                }
+            });
+        });
+        CHECK(threw);
+        CHECK(visited.load() == 1000);
+    }
+
+    // The pool keeps working afterwards
+    std::atomic<size_t> visited{0};
+    threadPool.parallelFor(1000, 10, [&](size_t begin, size_t end) {
+        visited.fetch_add(end - begin, std::memory_order_relaxed);
+    });
+    CHECK(visited.load() == 1000);
+}